@@ -60,125 +60,2860 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <math.h>
 #include <optional>
 #include <stdint.h>
+#include <string.h>
+#include <type_traits>
+#include <utility>
+
+#if (__cplusplus >= 202002L) && __has_include(<span>)
+#define REEDSOLOMON_SPAN 1
+#include <span>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define REEDSOLOMON_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__)
+#define REEDSOLOMON_NOINLINE __attribute__((noinline))
+#else
+#define REEDSOLOMON_NOINLINE
+#endif
 
 namespace reedsolomon
 {
+  namespace detail
+  {
+    /// @brief Get coefficients of the irreducible polynomial p(X) generating GF(2**BitsPerSymbol)
+    /// @tparam BitsPerSymbol Number of bits per symbol
+    /// @return Polynomial coefficients pp[0]..pp[BitsPerSymbol]
+    template <uint8_t BitsPerSymbol>
+    constexpr std::array<int, BitsPerSymbol + 1U> primitive_poly()
+    {
+      if constexpr (BitsPerSymbol == 2U)
+      {
+        /* 1 + x + x^2 */
+        return {1, 1, 1};
+      }
+      else if constexpr (BitsPerSymbol == 3U)
+      {
+        /* 1 + x + x^3 */
+        return {1, 1, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 4U)
+      {
+        /* 1 + x + x^4 */
+        return {1, 1, 0, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 5U)
+      {
+        /* 1 + x^2 + x^5 */
+        return {1, 0, 1, 0, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 6U)
+      {
+        /* 1 + x + x^6 */
+        return {1, 1, 0, 0, 0, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 7U)
+      {
+        /* 1 + x^3 + x^7 */
+        return {1, 0, 0, 1, 0, 0, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 8U)
+      {
+        /* 1 + x^2 + x^3 + x^4 + x^8 */
+        return {1, 0, 1, 1, 1, 0, 0, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 9U)
+      {
+        /* 1 + x^4 + x^9 */
+        return {1, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 10U)
+      {
+        /* 1 + x^3 + x^10 */
+        return {1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 11U)
+      {
+        /* 1 + x^2 + x^11 */
+        return {1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 12U)
+      {
+        /* 1 + x + x^4 + x^6 + x^12 */
+        return {1, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 13U)
+      {
+        /* 1 + x + x^3 + x^4 + x^13 */
+        return {1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 14U)
+      {
+        /* 1 + x + x^6 + x^10 + x^14 */
+        return {1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1};
+      }
+      else if constexpr (BitsPerSymbol == 15U)
+      {
+        /* 1 + x + x^15 */
+        return {1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+      }
+      else
+      {
+        /* 1 + x + x^3 + x^12 + x^16 */
+        return {1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1};
+      }
+    }
+
+    /// @brief Galois Field GF(2**BitsPerSymbol) lookup tables
+    /// @tparam BitsPerSymbol Number of bits per symbol
+    template <uint8_t BitsPerSymbol>
+    struct GaloisField
+    {
+      /// @brief Number of non-zero field elements
+      static constexpr uint16_t size{(1U << BitsPerSymbol) - 1U};
+
+      /// @brief Field element in polynomial form
+      using Symbol = std::conditional_t<(BitsPerSymbol <= 8U), uint8_t, uint16_t>;
+
+      /// @brief Field element in index form (able to hold A0, sums of indexes being formed as int)
+      using Index = std::conditional_t<(BitsPerSymbol <= 7U), uint8_t, std::conditional_t<(BitsPerSymbol <= 15U), uint16_t, uint32_t>>;
+
+      /// @brief Index form of the zero element
+      /// @note Any sum of indexes involving A0 lands in the zero padded part of alpha_to[], hence multiplication needs no branches.
+      ///       The price is alpha_to[] of 2*A0+1 = 4*size-1 symbols and A0 not fitting uint16_t for 16 bit symbols: above
+      ///       GF(2**8) both tables take about 1.25x the bytes of a pair of int tables of size+1 entries (1.5x for GF(2**16))
+      static constexpr Index A0{2U * size - 1U};
+
+      /// @brief Reduce an index sum modulo size without division (as 2**mm = 1 mod size)
+      /// @param x Non-negative index sum
+      /// @return x mod size
+      static constexpr int modnn(int x)
+      {
+        while (x >= size)
+        {
+          x -= size;
+          x = (x >> BitsPerSymbol) + (x & size);
+        }
+        return x;
+      }
+
+      std::array<int, BitsPerSymbol + 1U> pp;
+      std::array<Symbol, 2U * A0 + 1U> alpha_to;
+      std::array<Index, size + 1U> index_of;
+    };
+
+    template <uint8_t BitsPerSymbol>
+    constexpr GaloisField<BitsPerSymbol> generate_gf()
+    /* generate GF(2**mm) from the irreducible polynomial p(X) in pp[0]..pp[mm]
+       lookup tables:  index->polynomial form   alpha_to[] contains j=alpha**i;
+                       polynomial form -> index form  index_of[j=alpha**i] = i
+       alpha=2 is the primitive element of GF(2**mm)
+       alpha_to[] is repeated for indexes nn..2*nn-2 and zero padded above so
+       that it may be addressed with a sum of two indexes, index_of[0] = A0
+    */
+    {
+      using Field = GaloisField<BitsPerSymbol>;
+      Field gf{primitive_poly<BitsPerSymbol>(), {}, {}};
+      int i{0}, mask{0};
+
+      mask = 1;
+      gf.alpha_to[BitsPerSymbol] = 0;
+      for (i = 0; i < BitsPerSymbol; i++)
+      {
+        gf.alpha_to[i] = mask;
+        gf.index_of[gf.alpha_to[i]] = i;
+        if (gf.pp[i] != 0)
+          gf.alpha_to[BitsPerSymbol] ^= mask;
+        mask <<= 1;
+      }
+      gf.index_of[gf.alpha_to[BitsPerSymbol]] = BitsPerSymbol;
+      mask >>= 1;
+      for (i = BitsPerSymbol + 1; i < Field::size; i++)
+      {
+        if (gf.alpha_to[i - 1] >= mask)
+          gf.alpha_to[i] = gf.alpha_to[BitsPerSymbol] ^ ((gf.alpha_to[i - 1] ^ mask) << 1);
+        else
+          gf.alpha_to[i] = gf.alpha_to[i - 1] << 1;
+        gf.index_of[gf.alpha_to[i]] = i;
+      }
+      for (i = Field::size; i < static_cast<int>(Field::A0); i++)
+        gf.alpha_to[i] = gf.alpha_to[i - Field::size];
+      gf.index_of[0] = Field::A0;
+
+      return gf;
+    }
+
+    /// @brief Galois Field tables shared by all the codecs using symbols of BitsPerSymbol bits
+    template <uint8_t BitsPerSymbol>
+    inline constexpr GaloisField<BitsPerSymbol> galois_field{generate_gf<BitsPerSymbol>()};
+
+    /// @brief Product of every pair of GF(2**BitsPerSymbol) elements in polynomial form
+    template <uint8_t BitsPerSymbol>
+    using MultiplicationTable = std::array<std::array<typename GaloisField<BitsPerSymbol>::Symbol, GaloisField<BitsPerSymbol>::size + 1U>, GaloisField<BitsPerSymbol>::size + 1U>;
+
+    template <uint8_t BitsPerSymbol>
+    constexpr MultiplicationTable<BitsPerSymbol> generate_mul_table()
+    /* mul[a][b] = a*b with both operands and the result in polynomial form,
+       a zero operand is A0 in index form so its row and column come out zero
+    */
+    {
+      constexpr auto &gf{galois_field<BitsPerSymbol>};
+      MultiplicationTable<BitsPerSymbol> mul{};
+      int a{0}, b{0};
+
+      for (a = 0; a <= GaloisField<BitsPerSymbol>::size; a++)
+        for (b = 0; b <= GaloisField<BitsPerSymbol>::size; b++)
+          mul[a][b] = gf.alpha_to[gf.index_of[a] + gf.index_of[b]];
+
+      return mul;
+    }
+
+    /// @brief Multiplication table shared by all the codecs using Arithmetic::MultiplicationTable
+    /// @note Only instantiated when used, GF(2**8) takes 64 KB
+    template <uint8_t BitsPerSymbol>
+    inline constexpr MultiplicationTable<BitsPerSymbol> multiplication_table{generate_mul_table<BitsPerSymbol>()};
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    constexpr std::array<typename GaloisField<BitsPerSymbol>::Index, 2U * AmountOfCorrectableSymbols + 1U> gen_poly()
+    /* Obtain the generator polynomial of the tt-error correcting, length
+      nn=(2**mm -1) Reed Solomon code  from the product of (X+alpha**i), i=1..2*tt
+    */
+    {
+      constexpr auto &gf{galois_field<BitsPerSymbol>};
+      constexpr int fecSize{2 * AmountOfCorrectableSymbols};
+      std::array<typename GaloisField<BitsPerSymbol>::Index, fecSize + 1U> gg{};
+      int i{0}, j{0};
+
+      gg[0] = 2; /* primitive element alpha = 2  for GF(2**mm)  */
+      gg[1] = 1; /* g(x) = (X+alpha) initially */
+      for (i = 2; i <= fecSize; i++)
+      {
+        gg[i] = 1;
+        for (j = i - 1; j > 0; j--)
+          gg[j] = gg[j - 1] ^ gf.alpha_to[gf.index_of[gg[j]] + i];
+        gg[0] = gf.alpha_to[gf.index_of[gg[0]] + i]; /* gg[0] can never be zero */
+      }
+      /* convert gg[] to index form for quicker encoding */
+      for (i = 0; i <= fecSize; i++)
+        gg[i] = gf.index_of[gg[i]];
+
+      return gg;
+    }
+
+    /// @brief Encoder taps, per feedback symbol the products with every generator polynomial coefficient
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    using EncoderTaps = std::array<std::array<typename GaloisField<BitsPerSymbol>::Symbol, 2U * AmountOfCorrectableSymbols>, GaloisField<BitsPerSymbol>::size + 1U>;
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    constexpr EncoderTaps<BitsPerSymbol, AmountOfCorrectableSymbols> generate_encoder_taps()
+    /* taps[feedback][j] = feedback*gg[j] in polynomial form, so that a single
+       row selected by the feedback symbol holds every tap of the LFSR step
+       (gg[2*tt] = 1 is implied by the shift and not stored)
+    */
+    {
+      constexpr auto &gf{galois_field<BitsPerSymbol>};
+      constexpr auto gg{gen_poly<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+      EncoderTaps<BitsPerSymbol, AmountOfCorrectableSymbols> taps{};
+      int feedback{0}, j{0};
+
+      for (feedback = 0; feedback <= GaloisField<BitsPerSymbol>::size; feedback++)
+        for (j = 0; j < 2 * AmountOfCorrectableSymbols; j++)
+          taps[feedback][j] = gf.alpha_to[gf.index_of[feedback] + gg[j]];
+
+      return taps;
+    }
+
+    /// @brief Encoder taps shared by all the codecs of the same code
+    /// @note Only instantiated when used, RS(255,223) takes 8 KB
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    inline constexpr EncoderTaps<BitsPerSymbol, AmountOfCorrectableSymbols> encoder_taps{generate_encoder_taps<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+
+    /// @brief Sliced encoder register length in 64 bit words, symbol j at bits 8*(j%8) of word j/8
+    template <uint8_t AmountOfCorrectableSymbols>
+    inline constexpr std::size_t encoder_words{(2U * AmountOfCorrectableSymbols + 7U) / 8U};
+
+    /// @brief Sliced encoder tables, per slice s and symbol x the parity register left by a run of Slices steps from
+    ///        a zero register, fed x at step s and zeros at the others (the last slice holds the encoder taps)
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, std::size_t Slices>
+    using EncoderSlices = std::array<std::array<std::array<uint64_t, encoder_words<AmountOfCorrectableSymbols>>, GaloisField<BitsPerSymbol>::size + 1U>, Slices>;
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, std::size_t Slices>
+    constexpr EncoderSlices<BitsPerSymbol, AmountOfCorrectableSymbols, Slices> generate_encoder_slices()
+    /* slice s is slice s+1 shifted once more with no input */
+    {
+      constexpr auto &taps{encoder_taps<BitsPerSymbol, AmountOfCorrectableSymbols>};
+      constexpr int fecSize{2 * AmountOfCorrectableSymbols};
+      EncoderSlices<BitsPerSymbol, AmountOfCorrectableSymbols, Slices> slices{};
+      int s{0}, x{0}, j{0};
+
+      for (x = 0; x <= GaloisField<BitsPerSymbol>::size; x++)
+      {
+        auto parity{taps[x]};
+        for (s = static_cast<int>(Slices) - 1; s >= 0; s--)
+        {
+          for (j = 0; j < fecSize; j++)
+            slices[s][x][j / 8] |= uint64_t{parity[j]} << (8 * (j % 8));
+          const auto &feedback{taps[parity[fecSize - 1]]};
+          for (j = fecSize - 1; j > 0; j--)
+            parity[j] = parity[j - 1] ^ feedback[j];
+          parity[0] = feedback[0];
+        }
+      }
+
+      return slices;
+    }
+
+    /// @brief Sliced encoder tables shared by all the codecs of the same code
+    /// @note Only instantiated when used, RS(255,223) takes 16 KB with 2 slices
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, std::size_t Slices>
+    inline constexpr EncoderSlices<BitsPerSymbol, AmountOfCorrectableSymbols, Slices> encoder_slices{generate_encoder_slices<BitsPerSymbol, AmountOfCorrectableSymbols, Slices>()};
+
+    /// @brief Symbol j of the sliced encoder register, zero below it
+    inline uint8_t encoder_symbol(const uint64_t *reg, int j)
+    {
+      return (j < 0) ? 0U : static_cast<uint8_t>(reg[j / 8] >> (8 * (j % 8)));
+    }
+
+    /// @brief Shift the sliced encoder register up by Shift symbols, the words unrolled
+    template <std::size_t Shift, std::size_t... Words>
+    inline void encoder_shift(uint64_t *reg, std::index_sequence<Words...>)
+    {
+      const uint64_t old[] = {reg[Words]...};
+      ((reg[Words] = (old[Words] << (8U * Shift)) | ((Words > 0U) ? old[Words - (Words > 0U)] >> (64U - 8U * Shift) : 0U)), ...);
+    }
+
+    /// @brief Add a row of every slice to the sliced encoder register, the words unrolled
+    template <std::size_t Slices, std::size_t... Words>
+    inline void encoder_add(uint64_t *reg, const uint64_t *const (&rows)[Slices], std::index_sequence<Words...>)
+    {
+      for (std::size_t s{0U}; s < Slices; s++)
+        ((reg[Words] ^= rows[s][Words]), ...);
+    }
+
+    /// @brief Multiplication by each constant c of a field with symbols of at most 8 bits
+    struct ConstantMultipliers
+    {
+      /// @brief Split nibble tables, the products c*x for x = 0..15 followed by c*(x << 4)
+      std::array<std::array<uint8_t, 32U>, 256U> nibbles;
+
+      /// @brief 8x8 bit-matrices for GF2P8AFFINEQB, the byte 7-i holds the row giving bit i of c*x
+      std::array<uint64_t, 256U> affine;
+    };
+
+    template <uint8_t BitsPerSymbol>
+    constexpr ConstantMultipliers generate_constant_multipliers()
+    /* multiplication by a constant is linear over GF(2): c*x is the sum of
+       c*2**j over the bits j set in x, which gives both the nibble products
+       and the columns of the bit-matrix, bits above BitsPerSymbol are never set
+    */
+    {
+      constexpr auto &gf{galois_field<BitsPerSymbol>};
+      ConstantMultipliers multipliers{};
+      int c{0}, x{0}, i{0}, j{0};
+
+      for (c = 0; c <= GaloisField<BitsPerSymbol>::size; c++)
+      {
+        for (x = 0; x < 16; x++)
+        {
+          if (x <= GaloisField<BitsPerSymbol>::size)
+            multipliers.nibbles[c][x] = gf.alpha_to[gf.index_of[c] + gf.index_of[x]];
+          if ((x << 4) <= GaloisField<BitsPerSymbol>::size)
+            multipliers.nibbles[c][16 + x] = gf.alpha_to[gf.index_of[c] + gf.index_of[x << 4]];
+        }
+        for (j = 0; j < BitsPerSymbol; j++)
+        {
+          const uint8_t column{gf.alpha_to[gf.index_of[c] + j]}; /* c*2**j */
+          for (i = 0; i < BitsPerSymbol; i++)
+            if ((column >> i) & 1U)
+              multipliers.affine[c] |= uint64_t{1U} << (8 * (7 - i) + j);
+        }
+      }
+
+      return multipliers;
+    }
+
+    /// @brief Constant multipliers shared by all the codecs using Arithmetic::Simd
+    template <uint8_t BitsPerSymbol>
+    inline constexpr ConstantMultipliers constant_multipliers{generate_constant_multipliers<BitsPerSymbol>()};
+
+    /// @brief Systematic parity matrix, row k holds the parity of a message with a single 1 at data[k]
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    using ParityRows = std::array<std::array<uint8_t, 2U * AmountOfCorrectableSymbols>, GaloisField<BitsPerSymbol>::size - 2U * AmountOfCorrectableSymbols>;
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    constexpr ParityRows<BitsPerSymbol, AmountOfCorrectableSymbols> generate_parity_rows()
+    /* data[0] is the last symbol shifted into the LFSR, so its row is gg[]
+       itself, row k is row k-1 shifted once more with no input
+    */
+    {
+      constexpr auto &taps{encoder_taps<BitsPerSymbol, AmountOfCorrectableSymbols>};
+      constexpr int fecSize{2 * AmountOfCorrectableSymbols};
+      ParityRows<BitsPerSymbol, AmountOfCorrectableSymbols> rows{};
+      std::size_t k{0U};
+      int j{0};
+
+      for (j = 0; j < fecSize; j++)
+        rows[0][j] = taps[1][j];
+      for (k = 1U; k < rows.size(); k++)
+      {
+        const auto &feedback{taps[rows[k - 1U][fecSize - 1]]};
+        for (j = fecSize - 1; j > 0; j--)
+          rows[k][j] = rows[k - 1U][j - 1] ^ feedback[j];
+        rows[k][0] = feedback[0];
+      }
+
+      return rows;
+    }
+
+    /// @brief Parity matrix shared by all the codecs of the same code using Arithmetic::Simd
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    inline constexpr ParityRows<BitsPerSymbol, AmountOfCorrectableSymbols> parity_rows{generate_parity_rows<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+
+    /// @brief Syndromes are evaluated in groups of 16 to hide the multiply latency
+    static constexpr std::size_t SyndromeGroup{16U};
+
+    /// @brief Multipliers of a group of syndromes S(i) evaluated in 16 phases, level 0 holding the Horner step
+    ///        alpha**16i and levels 1..4 alpha**8i, alpha**4i, alpha**2i, alpha**i folding the phases
+    struct SyndromeMultipliers
+    {
+      /// @brief Low nibble products of the multiplier of each syndrome of the group, see ConstantMultipliers
+      uint8_t lo[5][SyndromeGroup][16];
+
+      /// @brief High nibble products
+      uint8_t hi[5][SyndromeGroup][16];
+
+      /// @brief Bit-matrices for GF2P8AFFINEQB, twice each so that the 16 phases of a syndrome share it
+      uint64_t affine[5][2U * SyndromeGroup];
+    };
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    using SyndromeMultipliersTable = std::array<SyndromeMultipliers, (2U * AmountOfCorrectableSymbols + SyndromeGroup - 1U) / SyndromeGroup>;
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    constexpr SyndromeMultipliersTable<BitsPerSymbol, AmountOfCorrectableSymbols> generate_syndrome_multipliers()
+    /* entries past 2*tt only pad the last group and are never used */
+    {
+      constexpr auto &gf{galois_field<BitsPerSymbol>};
+      constexpr auto &multipliers{constant_multipliers<BitsPerSymbol>};
+      SyndromeMultipliersTable<BitsPerSymbol, AmountOfCorrectableSymbols> table{};
+      int i{0}, level{0}, x{0};
+
+      for (level = 0; level < 5; level++)
+        for (i = 1; i <= 2 * AmountOfCorrectableSymbols; i++)
+        {
+          auto &group{table[(i - 1) / SyndromeGroup]};
+          const int k{(i - 1) % static_cast<int>(SyndromeGroup)};
+          const auto c{gf.alpha_to[GaloisField<BitsPerSymbol>::modnn((16 >> level) * i)]};
+          for (x = 0; x < 16; x++)
+          {
+            group.lo[level][k][x] = multipliers.nibbles[c][x];
+            group.hi[level][k][x] = multipliers.nibbles[c][16 + x];
+          }
+          group.affine[level][2 * k] = multipliers.affine[c];
+          group.affine[level][2 * k + 1] = multipliers.affine[c];
+        }
+
+      return table;
+    }
+
+    /// @brief Syndrome multipliers shared by all the codecs of the same code using Arithmetic::Simd
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    inline constexpr SyndromeMultipliersTable<BitsPerSymbol, AmountOfCorrectableSymbols> syndrome_multipliers{generate_syndrome_multipliers<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+
+    /// @brief Multiply-accumulate rows kernel: dst[w] ^= coeffs[k] * rows[k * stride + w] for k < count, w < width
+    /// @note Symbols of at most 8 bits, multipliers are the ones of the field
+    using MacRowsKernel = void (*)(uint8_t *dst, const uint8_t *rows, std::size_t stride, const uint8_t *coeffs, const ConstantMultipliers &multipliers, std::size_t count, std::size_t width);
+
+    inline void mac_rows_scalar(uint8_t *dst, const uint8_t *rows, std::size_t stride, const uint8_t *coeffs, const ConstantMultipliers &multipliers, std::size_t count, std::size_t width)
+    {
+      for (std::size_t k{0U}; k < count; k++)
+      {
+        const uint8_t *const c{multipliers.nibbles[coeffs[k]].data()};
+        const uint8_t *const row{rows + k * stride};
+        for (std::size_t w{0U}; w < width; w++)
+          dst[w] ^= c[row[w] & 0x0FU] ^ c[16U + (row[w] >> 4)];
+      }
+    }
+
+#ifdef REEDSOLOMON_X86_SIMD
+    /// @brief Multiply 16 symbols by the constant whose low/high nibble products are in lo/hi
+    __attribute__((target("ssse3"))) inline __m128i mul_ssse3(__m128i x, __m128i lo, __m128i hi)
+    {
+      const __m128i mask{_mm_set1_epi8(0x0F)};
+      return _mm_xor_si128(_mm_shuffle_epi8(lo, _mm_and_si128(x, mask)),
+                           _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi64(x, 4), mask)));
+    }
+
+    __attribute__((target("ssse3"))) inline void mac_rows_ssse3(uint8_t *dst, const uint8_t *rows, std::size_t stride, const uint8_t *coeffs, const ConstantMultipliers &multipliers, std::size_t count, std::size_t width)
+    {
+      std::size_t w{0U};
+      for (; w + 16U <= width; w += 16U)
+      {
+        __m128i acc{_mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + w))};
+        for (std::size_t k{0U}; k < count; k++)
+        {
+          const uint8_t *const c{multipliers.nibbles[coeffs[k]].data()};
+          acc = _mm_xor_si128(acc, mul_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i *>(rows + k * stride + w)),
+                                             _mm_loadu_si128(reinterpret_cast<const __m128i *>(c)),
+                                             _mm_loadu_si128(reinterpret_cast<const __m128i *>(c + 16U))));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + w), acc);
+      }
+      if (w < width)
+        mac_rows_scalar(dst + w, rows + w, stride, coeffs, multipliers, count, width - w);
+    }
+
+    /// @brief Multiply 32 symbols by the constant whose low/high nibble products are in lo/hi
+    __attribute__((target("avx2"))) inline __m256i mul_avx2(__m256i x, __m256i lo, __m256i hi)
+    {
+      const __m256i mask{_mm256_set1_epi8(0x0F)};
+      return _mm256_xor_si256(_mm256_shuffle_epi8(lo, _mm256_and_si256(x, mask)),
+                              _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi64(x, 4), mask)));
+    }
+
+    __attribute__((target("avx2"))) inline void mac_rows_avx2(uint8_t *dst, const uint8_t *rows, std::size_t stride, const uint8_t *coeffs, const ConstantMultipliers &multipliers, std::size_t count, std::size_t width)
+    {
+      std::size_t w{0U};
+      for (; w + 32U <= width; w += 32U)
+      {
+        __m256i acc{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + w))};
+        for (std::size_t k{0U}; k < count; k++)
+        {
+          const uint8_t *const c{multipliers.nibbles[coeffs[k]].data()};
+          acc = _mm256_xor_si256(acc, mul_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(rows + k * stride + w)),
+                                               _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(c))),
+                                               _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(c + 16U)))));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + w), acc);
+      }
+      if (w < width)
+        mac_rows_ssse3(dst + w, rows + w, stride, coeffs, multipliers, count, width - w);
+    }
+
+    /// @brief Multiply 64 symbols by the constant whose low/high nibble products are in lo/hi
+    /// @note Zero masking forms with all lanes set are used as the plain ones trip -Wmaybe-uninitialized on GCC
+    __attribute__((target("avx512bw"))) inline __m512i mul_avx512bw(__m512i x, __m512i lo, __m512i hi)
+    {
+      const __m512i mask{_mm512_set1_epi8(0x0F)};
+      return _mm512_xor_si512(_mm512_shuffle_epi8(lo, _mm512_and_si512(x, mask)),
+                              _mm512_shuffle_epi8(hi, _mm512_and_si512(_mm512_maskz_srli_epi64(0xFFU, x, 4), mask)));
+    }
+
+    __attribute__((target("avx512bw"))) inline void mac_rows_avx512bw(uint8_t *dst, const uint8_t *rows, std::size_t stride, const uint8_t *coeffs, const ConstantMultipliers &multipliers, std::size_t count, std::size_t width)
+    {
+      std::size_t w{0U};
+      for (; w + 64U <= width; w += 64U)
+      {
+        __m512i acc{_mm512_loadu_si512(dst + w)};
+        for (std::size_t k{0U}; k < count; k++)
+        {
+          const uint8_t *const c{multipliers.nibbles[coeffs[k]].data()};
+          acc = _mm512_xor_si512(acc, mul_avx512bw(_mm512_loadu_si512(rows + k * stride + w),
+                                                   _mm512_maskz_broadcast_i32x4(0xFFFFU, _mm_loadu_si128(reinterpret_cast<const __m128i *>(c))),
+                                                   _mm512_maskz_broadcast_i32x4(0xFFFFU, _mm_loadu_si128(reinterpret_cast<const __m128i *>(c + 16U)))));
+        }
+        _mm512_storeu_si512(dst + w, acc);
+      }
+      if (w < width)
+        mac_rows_avx2(dst + w, rows + w, stride, coeffs, multipliers, count, width - w);
+    }
+
+    __attribute__((target("gfni,sse2"))) inline void mac_rows_gfni_sse(uint8_t *dst, const uint8_t *rows, std::size_t stride, const uint8_t *coeffs, const ConstantMultipliers &multipliers, std::size_t count, std::size_t width)
+    {
+      std::size_t w{0U};
+      for (; w + 16U <= width; w += 16U)
+      {
+        __m128i acc{_mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + w))};
+        for (std::size_t k{0U}; k < count; k++)
+          acc = _mm_xor_si128(acc, _mm_gf2p8affine_epi64_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(rows + k * stride + w)),
+                                                              _mm_set1_epi64x(static_cast<long long>(multipliers.affine[coeffs[k]])), 0));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + w), acc);
+      }
+      if (w < width)
+        mac_rows_scalar(dst + w, rows + w, stride, coeffs, multipliers, count, width - w);
+    }
+
+    __attribute__((target("gfni,avx2"))) inline void mac_rows_gfni_avx2(uint8_t *dst, const uint8_t *rows, std::size_t stride, const uint8_t *coeffs, const ConstantMultipliers &multipliers, std::size_t count, std::size_t width)
+    {
+      std::size_t w{0U};
+      for (; w + 32U <= width; w += 32U)
+      {
+        __m256i acc{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + w))};
+        for (std::size_t k{0U}; k < count; k++)
+          acc = _mm256_xor_si256(acc, _mm256_gf2p8affine_epi64_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(rows + k * stride + w)),
+                                                                    _mm256_set1_epi64x(static_cast<long long>(multipliers.affine[coeffs[k]])), 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + w), acc);
+      }
+      if (w < width)
+        mac_rows_gfni_sse(dst + w, rows + w, stride, coeffs, multipliers, count, width - w);
+    }
+
+    __attribute__((target("gfni,avx512bw"))) inline void mac_rows_gfni_avx512bw(uint8_t *dst, const uint8_t *rows, std::size_t stride, const uint8_t *coeffs, const ConstantMultipliers &multipliers, std::size_t count, std::size_t width)
+    {
+      std::size_t w{0U};
+      for (; w + 64U <= width; w += 64U)
+      {
+        __m512i acc{_mm512_loadu_si512(dst + w)};
+        for (std::size_t k{0U}; k < count; k++)
+          acc = _mm512_xor_si512(acc, _mm512_gf2p8affine_epi64_epi8(_mm512_loadu_si512(rows + k * stride + w),
+                                                                    _mm512_set1_epi64(static_cast<long long>(multipliers.affine[coeffs[k]])), 0));
+        _mm512_storeu_si512(dst + w, acc);
+      }
+      if (w < width)
+        mac_rows_gfni_avx2(dst + w, rows + w, stride, coeffs, multipliers, count, width - w);
+    }
+#endif
+
+    /// @brief Pick the multiply-accumulate rows kernel for the CPU, GFNI first then the widest nibble shuffles
+    inline MacRowsKernel select_mac_rows_kernel()
+    {
+#ifdef REEDSOLOMON_X86_SIMD
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("gfni"))
+      {
+        if (__builtin_cpu_supports("avx512bw"))
+          return mac_rows_gfni_avx512bw;
+        if (__builtin_cpu_supports("avx2"))
+          return mac_rows_gfni_avx2;
+        return mac_rows_gfni_sse;
+      }
+      if (__builtin_cpu_supports("avx512bw"))
+        return mac_rows_avx512bw;
+      if (__builtin_cpu_supports("avx2"))
+        return mac_rows_avx2;
+      if (__builtin_cpu_supports("ssse3"))
+        return mac_rows_ssse3;
+#endif
+      return mac_rows_scalar;
+    }
+
+    /// @brief Multiply-accumulate rows kernel picked on first use
+    inline MacRowsKernel mac_rows_kernel()
+    {
+      static const MacRowsKernel kernel{select_mac_rows_kernel()};
+      return kernel;
+    }
+
+    /// @brief Multiply the sliced encoder register by X**run mod g(X), for run >= 2*tt, as the sum of its symbols j
+    ///        times the parity rows run-2*tt+j, which hold X**(run+j) mod g(X)
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    inline void encoder_jump(uint64_t (&reg)[encoder_words<AmountOfCorrectableSymbols>], std::size_t run)
+    {
+      constexpr auto &rows{parity_rows<BitsPerSymbol, AmountOfCorrectableSymbols>};
+      constexpr std::size_t fecSize{2U * AmountOfCorrectableSymbols};
+      uint8_t symbols[fecSize], jumped[fecSize] = {};
+
+      for (std::size_t j{0U}; j < fecSize; j++)
+        symbols[j] = encoder_symbol(reg, static_cast<int>(j));
+      mac_rows_kernel()(jumped, rows[run - fecSize].data(), fecSize, symbols, constant_multipliers<BitsPerSymbol>, fecSize, fecSize);
+      for (auto &word : reg)
+        word = 0U;
+      for (std::size_t j{0U}; j < fecSize; j++)
+        reg[j / 8U] |= uint64_t{jumped[j]} << (8U * (j % 8U));
+    }
+
+    /// @brief Field polynomial and Barrett constant for carry-less arithmetic
+    struct CarryLessField
+    {
+      /// @brief Field polynomial p(X)
+      uint64_t poly;
+
+      /// @brief X**(2*BitsPerSymbol) divided by p(X)
+      uint64_t mu;
+
+      /// @brief Number of bits per symbol
+      uint8_t bits;
+    };
+
+    template <uint8_t BitsPerSymbol>
+    constexpr CarryLessField generate_carry_less_field()
+    {
+      constexpr auto pp{primitive_poly<BitsPerSymbol>()};
+      CarryLessField field{0U, 0U, BitsPerSymbol};
+      uint64_t remainder{uint64_t{1U} << (2 * BitsPerSymbol)};
+      int i{0};
+
+      for (i = 0; i <= BitsPerSymbol; i++)
+        if (pp[i] != 0)
+          field.poly |= uint64_t{1U} << i;
+      for (i = 2 * BitsPerSymbol; i >= BitsPerSymbol; i--)
+        if ((remainder >> i) & 1U)
+        {
+          field.mu |= uint64_t{1U} << (i - BitsPerSymbol);
+          remainder ^= field.poly << (i - BitsPerSymbol);
+        }
+
+      return field;
+    }
+
+    /// @brief Carry-less arithmetic constants shared by all the codecs using Arithmetic::CarryLess
+    template <uint8_t BitsPerSymbol>
+    inline constexpr CarryLessField carry_less_field{generate_carry_less_field<BitsPerSymbol>()};
+
+    /// @brief Powers of alpha**i used to evaluate the syndrome S(i) in 16 phases
+    struct CarryLessPowers
+    {
+      /// @brief alpha**(i*k) in the low and alpha**(i*(k+8)) in the high 32 bits, k = 0..7
+      uint64_t phase[8];
+
+      /// @brief alpha**(16*i)
+      uint64_t step;
+    };
+
+    /// @brief Syndromes are computed in groups of 4 to hide the multiply latency
+    static constexpr std::size_t CarryLessGroup{4U};
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    using CarryLessPowersTable = std::array<CarryLessPowers, (2U * AmountOfCorrectableSymbols + CarryLessGroup - 1U) / CarryLessGroup * CarryLessGroup>;
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    constexpr CarryLessPowersTable<BitsPerSymbol, AmountOfCorrectableSymbols> generate_carry_less_powers()
+    /* entries past 2*tt only pad the last group and are never used */
+    {
+      constexpr auto &gf{galois_field<BitsPerSymbol>};
+      CarryLessPowersTable<BitsPerSymbol, AmountOfCorrectableSymbols> powers{};
+      int i{0}, k{0};
+
+      for (i = 1; i <= 2 * AmountOfCorrectableSymbols; i++)
+      {
+        auto &p{powers[i - 1]};
+        for (k = 0; k < 8; k++)
+          p.phase[k] = gf.alpha_to[GaloisField<BitsPerSymbol>::modnn(i * k)] | (uint64_t{gf.alpha_to[GaloisField<BitsPerSymbol>::modnn(i * (k + 8))]} << 32);
+        p.step = gf.alpha_to[GaloisField<BitsPerSymbol>::modnn(16 * i)];
+      }
+
+      return powers;
+    }
+
+    /// @brief Syndrome powers shared by all the codecs of the same code using Arithmetic::CarryLess
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    inline constexpr CarryLessPowersTable<BitsPerSymbol, AmountOfCorrectableSymbols> carry_less_powers{generate_carry_less_powers<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+
+    /// @brief Syndromes kernel: syndromes[i] = r(alpha**(i+1)) for i < count, r[0..size) in polynomial form
+    /// @note powers holds count entries rounded up to CarryLessGroup
+    using CarryLessSyndromesKernel = void (*)(uint16_t *syndromes, const uint16_t *r, std::size_t size, const CarryLessField &field, const CarryLessPowers *powers, std::size_t count);
+
+#ifdef REEDSOLOMON_X86_SIMD
+    /// @brief Load the Width coefficients r[Width*q..Width*q+Width-1] of a block, the top block zero padded
+    template <typename Coefficient, std::size_t Width>
+    inline const Coefficient *symbol_block(const Coefficient *r, std::size_t size, std::size_t q, Coefficient (&padded)[Width])
+    {
+      if (Width * q + Width <= size)
+        return r + Width * q;
+      for (std::size_t k{0U}; k < Width; k++)
+        padded[k] = (Width * q + k < size) ? r[Width * q + k] : 0U;
+      return padded;
+    }
+
+    /// @brief Carry-less multiply (low 64 bits of the product)
+    __attribute__((target("pclmul,sse2"))) inline uint64_t clmul(uint64_t a, uint64_t b)
+    {
+      return static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_clmulepi64_si128(_mm_cvtsi64_si128(static_cast<long long>(a)), _mm_cvtsi64_si128(static_cast<long long>(b)), 0)));
+    }
+
+    /// @brief Reduce modulo p(X) the two products packed at bits 0 and 32 of t (Barrett reduction)
+    /// @note Each product has degree at most 2*bits-2 < 31, so the lanes never reach each other
+    __attribute__((target("pclmul,sse2"))) inline uint64_t carry_less_reduce(uint64_t t, const CarryLessField &field)
+    {
+      const uint64_t quotientMask{((uint64_t{1U} << (field.bits - 1U)) - 1U) * ((uint64_t{1U} << 32) + 1U)};
+      const uint64_t symbolMask{((uint64_t{1U} << field.bits) - 1U) * ((uint64_t{1U} << 32) + 1U)};
+      const uint64_t quotient{(clmul((t >> field.bits) & quotientMask, field.mu) >> field.bits) & quotientMask};
+      return (t ^ clmul(quotient, field.poly)) & symbolMask;
+    }
+
+    __attribute__((target("pclmul,sse2"))) inline void carry_less_syndromes_pclmul(uint16_t *syndromes, const uint16_t *r, std::size_t size, const CarryLessField &field, const CarryLessPowers *powers, std::size_t count)
+    /* r(X) is split in 16 phases, r(X) = sum of X**p * Rp(X**16) for p = 0..15,
+       which are evaluated at alpha**16i by Horner's rule. Phases p and p+8
+       share a word (low and high 32 bits), so every carry-less multiply yields
+       two products. The phases are weighted by alpha**ip and summed unreduced,
+       reduction being linear, then reduced once.
+    */
+    {
+      const std::size_t blocks{(size + 15U) / 16U};
+      uint16_t padded[16];
+
+      for (std::size_t i{0U}; i < count; i++)
+      {
+        const CarryLessPowers &p{powers[i]};
+        uint64_t acc[8] = {};
+        for (std::size_t q{blocks}; q-- > 0U;)
+        {
+          const uint16_t *const block{symbol_block(r, size, q, padded)};
+          for (std::size_t k{0U}; k < 8U; k++)
+            acc[k] = carry_less_reduce(clmul(acc[k], p.step), field) ^ block[k] ^ (uint64_t{block[k + 8U]} << 32);
+        }
+        uint64_t sum{0U};
+        for (std::size_t k{0U}; k < 8U; k++)
+          sum ^= clmul(acc[k] & 0xFFFFFFFFU, p.phase[k] & 0xFFFFFFFFU) ^ clmul(acc[k] >> 32, p.phase[k] >> 32);
+        syndromes[i] = static_cast<uint16_t>(carry_less_reduce(sum, field));
+      }
+    }
+
+    /// @brief Carry-less multiply of every 64 bit lane of a by the one of b (low 64 bits of the products)
+    /// @note As in mul_avx512bw() zero masking forms with all lanes set avoid -Wmaybe-uninitialized on GCC
+    __attribute__((target("vpclmulqdq,pclmul,avx512f"))) inline __m512i clmul_avx512(__m512i a, __m512i b)
+    {
+      return _mm512_maskz_unpacklo_epi64(0xFFU, _mm512_clmulepi64_epi128(a, b, 0x00), _mm512_clmulepi64_epi128(a, b, 0x11));
+    }
+
+    /// @brief Barrett reduction of every 64 bit lane, see carry_less_reduce()
+    __attribute__((target("vpclmulqdq,pclmul,avx512f"))) inline __m512i carry_less_reduce_avx512(__m512i t, __m512i poly, __m512i mu, __m128i bits, __m512i quotientMask, __m512i symbolMask)
+    {
+      const __m512i quotient{_mm512_and_si512(_mm512_maskz_srl_epi64(0xFFU, clmul_avx512(_mm512_and_si512(_mm512_maskz_srl_epi64(0xFFU, t, bits), quotientMask), mu), bits), quotientMask)};
+      return _mm512_and_si512(_mm512_xor_si512(t, clmul_avx512(quotient, poly)), symbolMask);
+    }
+
+    __attribute__((target("vpclmulqdq,pclmul,avx512f"))) inline void carry_less_syndromes_avx512(uint16_t *syndromes, const uint16_t *r, std::size_t size, const CarryLessField &field, const CarryLessPowers *powers, std::size_t count)
+    /* carry_less_syndromes_pclmul() with the 8 words of a syndrome in one
+       register, a group of syndromes is advanced together
+    */
+    {
+      const std::size_t blocks{(size + 15U) / 16U};
+      const __m512i poly{_mm512_set1_epi64(static_cast<long long>(field.poly))};
+      const __m512i mu{_mm512_set1_epi64(static_cast<long long>(field.mu))};
+      const __m128i bits{_mm_cvtsi32_si128(field.bits)};
+      const __m512i quotientMask{_mm512_set1_epi64(static_cast<long long>(((uint64_t{1U} << (field.bits - 1U)) - 1U) * ((uint64_t{1U} << 32) + 1U)))};
+      const __m512i symbolMask{_mm512_set1_epi64(static_cast<long long>(((uint64_t{1U} << field.bits) - 1U) * ((uint64_t{1U} << 32) + 1U)))};
+      const __m512i lowHalf{_mm512_set1_epi64(0xFFFFFFFFLL)};
+      uint16_t padded[16];
+
+      for (std::size_t i{0U}; i < count; i += CarryLessGroup)
+      {
+        __m512i acc[CarryLessGroup], step[CarryLessGroup];
+        for (std::size_t g{0U}; g < CarryLessGroup; g++)
+        {
+          acc[g] = _mm512_setzero_si512();
+          step[g] = _mm512_set1_epi64(static_cast<long long>(powers[i + g].step));
+        }
+        for (std::size_t q{blocks}; q-- > 0U;)
+        {
+          const uint16_t *const block{symbol_block(r, size, q, padded)};
+          const __m512i terms{_mm512_or_si512(_mm512_maskz_cvtepu16_epi64(0xFFU, _mm_loadu_si128(reinterpret_cast<const __m128i *>(block))),
+                                              _mm512_maskz_slli_epi64(0xFFU, _mm512_maskz_cvtepu16_epi64(0xFFU, _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 8U))), 32))};
+          for (std::size_t g{0U}; g < CarryLessGroup; g++)
+            acc[g] = _mm512_xor_si512(carry_less_reduce_avx512(clmul_avx512(acc[g], step[g]), poly, mu, bits, quotientMask, symbolMask), terms);
+        }
+        for (std::size_t g{0U}; (g < CarryLessGroup) && (i + g < count); g++)
+        {
+          const __m512i phase{_mm512_loadu_si512(powers[i + g].phase)};
+          const __m512i weighted{_mm512_xor_si512(clmul_avx512(_mm512_and_si512(acc[g], lowHalf), _mm512_and_si512(phase, lowHalf)),
+                                                  clmul_avx512(_mm512_maskz_srli_epi64(0xFFU, acc[g], 32), _mm512_maskz_srli_epi64(0xFFU, phase, 32)))};
+          alignas(64) uint64_t lanes[8];
+          _mm512_store_si512(lanes, weighted);
+          uint64_t sum{0U};
+          for (std::size_t k{0U}; k < 8U; k++)
+            sum ^= lanes[k];
+          syndromes[i + g] = static_cast<uint16_t>(carry_less_reduce(sum, field));
+        }
+      }
+    }
+#endif
+
+    /// @brief Pick the carry-less syndromes kernel for the CPU
+    /// @return nullptr when there is no carry-less multiply instruction, a software one being far slower than the tables
+    inline CarryLessSyndromesKernel select_carry_less_syndromes_kernel()
+    {
+#ifdef REEDSOLOMON_X86_SIMD
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("vpclmulqdq") && __builtin_cpu_supports("avx512f"))
+        return carry_less_syndromes_avx512;
+      if (__builtin_cpu_supports("pclmul"))
+        return carry_less_syndromes_pclmul;
+#endif
+      return nullptr;
+    }
+
+    /// @brief Carry-less syndromes kernel picked on first use
+    inline CarryLessSyndromesKernel carry_less_syndromes_kernel()
+    {
+      static const CarryLessSyndromesKernel kernel{select_carry_less_syndromes_kernel()};
+      return kernel;
+    }
+
+    /// @brief Syndromes kernel: syndromes[i] = r(alpha**(i+1)) for i < count, r[0..size) and the syndromes in polynomial form
+    /// @note Symbols of at most 8 bits, multipliers hold count entries rounded up to SyndromeGroup
+    using SyndromesKernel = void (*)(uint8_t *syndromes, const uint8_t *r, std::size_t size, const SyndromeMultipliers *multipliers, std::size_t count);
+
+    inline void syndromes_scalar(uint8_t *syndromes, const uint8_t *r, std::size_t size, const SyndromeMultipliers *multipliers, std::size_t count)
+    /* Horner's rule, the syndromes of a group advancing together by alpha**i */
+    {
+      for (std::size_t i{0U}; i < count; i += SyndromeGroup)
+      {
+        const SyndromeMultipliers &m{multipliers[i / SyndromeGroup]};
+        uint8_t acc[SyndromeGroup] = {};
+        for (std::size_t j{size}; j-- > 0U;)
+          for (std::size_t k{0U}; k < SyndromeGroup; k++)
+            acc[k] = m.lo[4][k][acc[k] & 0x0FU] ^ m.hi[4][k][acc[k] >> 4] ^ r[j];
+        for (std::size_t k{0U}; (k < SyndromeGroup) && (i + k < count); k++)
+          syndromes[i + k] = acc[k];
+      }
+    }
+
+#ifdef REEDSOLOMON_X86_SIMD
+    /// @brief Add to every lane of acc its product by the multiplier whose nibble products are in lo/hi, moved down Bytes
+    template <int Bytes>
+    __attribute__((target("ssse3"))) inline __m128i fold_ssse3(__m128i acc, const uint8_t *lo, const uint8_t *hi)
+    {
+      return _mm_xor_si128(acc, _mm_srli_si128(mul_ssse3(acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(lo)), _mm_loadu_si128(reinterpret_cast<const __m128i *>(hi))), Bytes));
+    }
+
+    __attribute__((target("ssse3"))) inline void syndromes_ssse3(uint8_t *syndromes, const uint8_t *r, std::size_t size, const SyndromeMultipliers *multipliers, std::size_t count)
+    /* r(X) is split in 16 phases, r(X) = sum of X**p * Rp(X**16) for p = 0..15,
+       the phases of a syndrome S(i) filling a lane of 16 bytes evaluated at
+       alpha**16i by Horner's rule, all the lanes taking the same block of r[].
+       The lane is then folded in halves, the upper 8 phases weighted by
+       alpha**8i being added to the lower ones, then 4 by alpha**4i and so on,
+       leaving S(i) in its lowest byte. 4 syndromes advance together.
+    */
+    {
+      const std::size_t blocks{(size + 15U) / 16U};
+      uint8_t padded[16];
+
+      for (std::size_t i{0U}; i < count; i += 4U)
+      {
+        const SyndromeMultipliers &m{multipliers[i / SyndromeGroup]};
+        const std::size_t needed{count - i}, vectors{(needed < 4U) ? needed : 4U}; /* skipping the padding of the last group */
+        const std::size_t k{i % SyndromeGroup};
+        __m128i acc[4], lo[4], hi[4];
+        for (std::size_t v{0U}; v < 4U; v++)
+        {
+          acc[v] = _mm_setzero_si128();
+          lo[v] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(m.lo[0][k + v]));
+          hi[v] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(m.hi[0][k + v]));
+        }
+        for (std::size_t q{blocks}; q-- > 0U;)
+        {
+          const __m128i block{_mm_loadu_si128(reinterpret_cast<const __m128i *>(symbol_block(r, size, q, padded)))};
+          for (std::size_t v{0U}; v < vectors; v++)
+            acc[v] = _mm_xor_si128(mul_ssse3(acc[v], lo[v], hi[v]), block);
+        }
+        for (std::size_t v{0U}; v < vectors; v++)
+        {
+          acc[v] = fold_ssse3<8>(acc[v], m.lo[1][k + v], m.hi[1][k + v]);
+          acc[v] = fold_ssse3<4>(acc[v], m.lo[2][k + v], m.hi[2][k + v]);
+          acc[v] = fold_ssse3<2>(acc[v], m.lo[3][k + v], m.hi[3][k + v]);
+          acc[v] = fold_ssse3<1>(acc[v], m.lo[4][k + v], m.hi[4][k + v]);
+          syndromes[i + v] = static_cast<uint8_t>(_mm_cvtsi128_si32(acc[v]));
+        }
+      }
+    }
+
+    template <int Bytes>
+    __attribute__((target("avx2"))) inline __m256i fold_avx2(__m256i acc, const uint8_t *lo, const uint8_t *hi)
+    {
+      return _mm256_xor_si256(acc, _mm256_srli_si256(mul_avx2(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lo)), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hi))), Bytes));
+    }
+
+    __attribute__((target("avx2"))) inline void syndromes_avx2(uint8_t *syndromes, const uint8_t *r, std::size_t size, const SyndromeMultipliers *multipliers, std::size_t count)
+    /* syndromes_ssse3() with 2 syndromes per register, 8 advancing together */
+    {
+      const std::size_t blocks{(size + 15U) / 16U};
+      uint8_t padded[16];
+
+      for (std::size_t i{0U}; i < count; i += 8U)
+      {
+        const SyndromeMultipliers &m{multipliers[i / SyndromeGroup]};
+        const std::size_t needed{(count - i + 1U) / 2U}, vectors{(needed < 4U) ? needed : 4U}; /* skipping the padding of the last group */
+        const std::size_t k{i % SyndromeGroup};
+        __m256i acc[4], lo[4], hi[4];
+        for (std::size_t v{0U}; v < 4U; v++)
+        {
+          acc[v] = _mm256_setzero_si256();
+          lo[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(m.lo[0][k + 2U * v]));
+          hi[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(m.hi[0][k + 2U * v]));
+        }
+        for (std::size_t q{blocks}; q-- > 0U;)
+        {
+          const __m256i block{_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(symbol_block(r, size, q, padded))))};
+          for (std::size_t v{0U}; v < vectors; v++)
+            acc[v] = _mm256_xor_si256(mul_avx2(acc[v], lo[v], hi[v]), block);
+        }
+        for (std::size_t v{0U}; v < vectors; v++)
+        {
+          acc[v] = fold_avx2<8>(acc[v], m.lo[1][k + 2U * v], m.hi[1][k + 2U * v]);
+          acc[v] = fold_avx2<4>(acc[v], m.lo[2][k + 2U * v], m.hi[2][k + 2U * v]);
+          acc[v] = fold_avx2<2>(acc[v], m.lo[3][k + 2U * v], m.hi[3][k + 2U * v]);
+          acc[v] = fold_avx2<1>(acc[v], m.lo[4][k + 2U * v], m.hi[4][k + 2U * v]);
+          alignas(32) uint8_t lanes[32];
+          _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc[v]);
+          for (std::size_t l{0U}; (l < 2U) && (i + 2U * v + l < count); l++)
+            syndromes[i + 2U * v + l] = lanes[16U * l];
+        }
+      }
+    }
+
+    template <int Bytes>
+    __attribute__((target("avx512bw"))) inline __m512i fold_avx512bw(__m512i acc, const uint8_t *lo, const uint8_t *hi)
+    {
+      return _mm512_xor_si512(acc, _mm512_bsrli_epi128(mul_avx512bw(acc, _mm512_loadu_si512(lo), _mm512_loadu_si512(hi)), Bytes));
+    }
+
+    __attribute__((target("avx512bw"))) inline void syndromes_avx512bw(uint8_t *syndromes, const uint8_t *r, std::size_t size, const SyndromeMultipliers *multipliers, std::size_t count)
+    /* syndromes_ssse3() with 4 syndromes per register, a whole group advancing together */
+    {
+      const std::size_t blocks{(size + 15U) / 16U};
+      uint8_t padded[16];
+
+      for (std::size_t i{0U}; i < count; i += SyndromeGroup)
+      {
+        const SyndromeMultipliers &m{multipliers[i / SyndromeGroup]};
+        const std::size_t needed{(count - i + 3U) / 4U}, vectors{(needed < 4U) ? needed : 4U}; /* skipping the padding of the last group */
+        __m512i acc[4], lo[4], hi[4];
+        for (std::size_t v{0U}; v < 4U; v++)
+        {
+          acc[v] = _mm512_setzero_si512();
+          lo[v] = _mm512_loadu_si512(m.lo[0][4U * v]);
+          hi[v] = _mm512_loadu_si512(m.hi[0][4U * v]);
+        }
+        for (std::size_t q{blocks}; q-- > 0U;)
+        {
+          const __m512i block{_mm512_maskz_broadcast_i32x4(0xFFFFU, _mm_loadu_si128(reinterpret_cast<const __m128i *>(symbol_block(r, size, q, padded))))};
+          for (std::size_t v{0U}; v < vectors; v++)
+            acc[v] = _mm512_xor_si512(mul_avx512bw(acc[v], lo[v], hi[v]), block);
+        }
+        for (std::size_t v{0U}; v < vectors; v++)
+        {
+          acc[v] = fold_avx512bw<8>(acc[v], m.lo[1][4U * v], m.hi[1][4U * v]);
+          acc[v] = fold_avx512bw<4>(acc[v], m.lo[2][4U * v], m.hi[2][4U * v]);
+          acc[v] = fold_avx512bw<2>(acc[v], m.lo[3][4U * v], m.hi[3][4U * v]);
+          acc[v] = fold_avx512bw<1>(acc[v], m.lo[4][4U * v], m.hi[4][4U * v]);
+          alignas(64) uint8_t lanes[64];
+          _mm512_store_si512(lanes, acc[v]);
+          for (std::size_t l{0U}; (l < 4U) && (i + 4U * v + l < count); l++)
+            syndromes[i + 4U * v + l] = lanes[16U * l];
+        }
+      }
+    }
+
+    /// @brief Add to every lane of acc its products by the bit-matrices, moved down Bytes
+    template <int Bytes>
+    __attribute__((target("gfni,sse2"))) inline __m128i fold_gfni_sse(__m128i acc, const uint64_t *affine)
+    {
+      return _mm_xor_si128(acc, _mm_srli_si128(_mm_gf2p8affine_epi64_epi8(acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(affine)), 0), Bytes));
+    }
+
+    __attribute__((target("gfni,sse2"))) inline void syndromes_gfni_sse(uint8_t *syndromes, const uint8_t *r, std::size_t size, const SyndromeMultipliers *multipliers, std::size_t count)
+    /* syndromes_ssse3() multiplying by bit-matrices */
+    {
+      const std::size_t blocks{(size + 15U) / 16U};
+      uint8_t padded[16];
+
+      for (std::size_t i{0U}; i < count; i += 4U)
+      {
+        const SyndromeMultipliers &m{multipliers[i / SyndromeGroup]};
+        const std::size_t needed{count - i}, vectors{(needed < 4U) ? needed : 4U}; /* skipping the padding of the last group */
+        const std::size_t k{i % SyndromeGroup};
+        __m128i acc[4], step[4];
+        for (std::size_t v{0U}; v < 4U; v++)
+        {
+          acc[v] = _mm_setzero_si128();
+          step[v] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&m.affine[0][2U * (k + v)]));
+        }
+        for (std::size_t q{blocks}; q-- > 0U;)
+        {
+          const __m128i block{_mm_loadu_si128(reinterpret_cast<const __m128i *>(symbol_block(r, size, q, padded)))};
+          for (std::size_t v{0U}; v < vectors; v++)
+            acc[v] = _mm_xor_si128(_mm_gf2p8affine_epi64_epi8(acc[v], step[v], 0), block);
+        }
+        for (std::size_t v{0U}; v < vectors; v++)
+        {
+          acc[v] = fold_gfni_sse<8>(acc[v], &m.affine[1][2U * (k + v)]);
+          acc[v] = fold_gfni_sse<4>(acc[v], &m.affine[2][2U * (k + v)]);
+          acc[v] = fold_gfni_sse<2>(acc[v], &m.affine[3][2U * (k + v)]);
+          acc[v] = fold_gfni_sse<1>(acc[v], &m.affine[4][2U * (k + v)]);
+          syndromes[i + v] = static_cast<uint8_t>(_mm_cvtsi128_si32(acc[v]));
+        }
+      }
+    }
+
+    template <int Bytes>
+    __attribute__((target("gfni,avx2"))) inline __m256i fold_gfni_avx2(__m256i acc, const uint64_t *affine)
+    {
+      return _mm256_xor_si256(acc, _mm256_srli_si256(_mm256_gf2p8affine_epi64_epi8(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(affine)), 0), Bytes));
+    }
+
+    __attribute__((target("gfni,avx2"))) inline void syndromes_gfni_avx2(uint8_t *syndromes, const uint8_t *r, std::size_t size, const SyndromeMultipliers *multipliers, std::size_t count)
+    /* syndromes_avx2() multiplying by bit-matrices */
+    {
+      const std::size_t blocks{(size + 15U) / 16U};
+      uint8_t padded[16];
+
+      for (std::size_t i{0U}; i < count; i += 8U)
+      {
+        const SyndromeMultipliers &m{multipliers[i / SyndromeGroup]};
+        const std::size_t needed{(count - i + 1U) / 2U}, vectors{(needed < 4U) ? needed : 4U}; /* skipping the padding of the last group */
+        const std::size_t k{i % SyndromeGroup};
+        __m256i acc[4], step[4];
+        for (std::size_t v{0U}; v < 4U; v++)
+        {
+          acc[v] = _mm256_setzero_si256();
+          step[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&m.affine[0][2U * (k + 2U * v)]));
+        }
+        for (std::size_t q{blocks}; q-- > 0U;)
+        {
+          const __m256i block{_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(symbol_block(r, size, q, padded))))};
+          for (std::size_t v{0U}; v < vectors; v++)
+            acc[v] = _mm256_xor_si256(_mm256_gf2p8affine_epi64_epi8(acc[v], step[v], 0), block);
+        }
+        for (std::size_t v{0U}; v < vectors; v++)
+        {
+          acc[v] = fold_gfni_avx2<8>(acc[v], &m.affine[1][2U * (k + 2U * v)]);
+          acc[v] = fold_gfni_avx2<4>(acc[v], &m.affine[2][2U * (k + 2U * v)]);
+          acc[v] = fold_gfni_avx2<2>(acc[v], &m.affine[3][2U * (k + 2U * v)]);
+          acc[v] = fold_gfni_avx2<1>(acc[v], &m.affine[4][2U * (k + 2U * v)]);
+          alignas(32) uint8_t lanes[32];
+          _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc[v]);
+          for (std::size_t l{0U}; (l < 2U) && (i + 2U * v + l < count); l++)
+            syndromes[i + 2U * v + l] = lanes[16U * l];
+        }
+      }
+    }
+
+    template <int Bytes>
+    __attribute__((target("gfni,avx512bw"))) inline __m512i fold_gfni_avx512bw(__m512i acc, const uint64_t *affine)
+    {
+      return _mm512_xor_si512(acc, _mm512_bsrli_epi128(_mm512_gf2p8affine_epi64_epi8(acc, _mm512_loadu_si512(affine), 0), Bytes));
+    }
+
+    __attribute__((target("gfni,avx512bw"))) inline void syndromes_gfni_avx512bw(uint8_t *syndromes, const uint8_t *r, std::size_t size, const SyndromeMultipliers *multipliers, std::size_t count)
+    /* syndromes_avx512bw() multiplying by bit-matrices */
+    {
+      const std::size_t blocks{(size + 15U) / 16U};
+      uint8_t padded[16];
+
+      for (std::size_t i{0U}; i < count; i += SyndromeGroup)
+      {
+        const SyndromeMultipliers &m{multipliers[i / SyndromeGroup]};
+        const std::size_t needed{(count - i + 3U) / 4U}, vectors{(needed < 4U) ? needed : 4U}; /* skipping the padding of the last group */
+        __m512i acc[4], step[4];
+        for (std::size_t v{0U}; v < 4U; v++)
+        {
+          acc[v] = _mm512_setzero_si512();
+          step[v] = _mm512_loadu_si512(&m.affine[0][8U * v]);
+        }
+        for (std::size_t q{blocks}; q-- > 0U;)
+        {
+          const __m512i block{_mm512_maskz_broadcast_i32x4(0xFFFFU, _mm_loadu_si128(reinterpret_cast<const __m128i *>(symbol_block(r, size, q, padded))))};
+          for (std::size_t v{0U}; v < vectors; v++)
+            acc[v] = _mm512_xor_si512(_mm512_gf2p8affine_epi64_epi8(acc[v], step[v], 0), block);
+        }
+        for (std::size_t v{0U}; v < vectors; v++)
+        {
+          acc[v] = fold_gfni_avx512bw<8>(acc[v], &m.affine[1][8U * v]);
+          acc[v] = fold_gfni_avx512bw<4>(acc[v], &m.affine[2][8U * v]);
+          acc[v] = fold_gfni_avx512bw<2>(acc[v], &m.affine[3][8U * v]);
+          acc[v] = fold_gfni_avx512bw<1>(acc[v], &m.affine[4][8U * v]);
+          alignas(64) uint8_t lanes[64];
+          _mm512_store_si512(lanes, acc[v]);
+          for (std::size_t l{0U}; (l < 4U) && (i + 4U * v + l < count); l++)
+            syndromes[i + 4U * v + l] = lanes[16U * l];
+        }
+      }
+    }
+#endif
+
+    /// @brief Pick the syndromes kernel for the CPU, GFNI first then the widest nibble shuffles
+    inline SyndromesKernel select_syndromes_kernel()
+    {
+#ifdef REEDSOLOMON_X86_SIMD
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("gfni"))
+      {
+        if (__builtin_cpu_supports("avx512bw"))
+          return syndromes_gfni_avx512bw;
+        if (__builtin_cpu_supports("avx2"))
+          return syndromes_gfni_avx2;
+        return syndromes_gfni_sse;
+      }
+      if (__builtin_cpu_supports("avx512bw"))
+        return syndromes_avx512bw;
+      if (__builtin_cpu_supports("avx2"))
+        return syndromes_avx2;
+      if (__builtin_cpu_supports("ssse3"))
+        return syndromes_ssse3;
+#endif
+      return syndromes_scalar;
+    }
+
+    /// @brief Syndromes kernel picked on first use
+    inline SyndromesKernel syndromes_kernel()
+    {
+      static const SyndromesKernel kernel{select_syndromes_kernel()};
+      return kernel;
+    }
+
+    /// @brief Systematic parity matrix stored by columns, column j holds parity symbol j of a message with a single
+    ///        1 at data[k] for every k, each pair of rows swapped and the columns zero padded to whole blocks
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    struct ParityColumns
+    {
+      /// @brief Column length, the message length rounded up to blocks of 16 symbols
+      static constexpr std::size_t stride{(GaloisField<BitsPerSymbol>::size - 2U * AmountOfCorrectableSymbols + 15U) / 16U * 16U};
+
+      /// @brief columns[j][k ^ 1] for data[k]
+      uint16_t columns[2U * AmountOfCorrectableSymbols][stride];
+    };
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    void generate_parity_columns(ParityColumns<BitsPerSymbol, AmountOfCorrectableSymbols> &parity)
+    /* rows as in generate_parity_rows(), stepped through alpha_to[] as they
+       are too many for the constant evaluator
+    */
+    {
+      constexpr auto &gf{galois_field<BitsPerSymbol>};
+      constexpr auto gg{gen_poly<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+      constexpr int fecSize{2 * AmountOfCorrectableSymbols};
+      constexpr int dataSize{GaloisField<BitsPerSymbol>::size - fecSize};
+      uint16_t row[fecSize];
+      int k{0}, j{0};
+
+      for (j = 0; j < fecSize; j++)
+        row[j] = gf.alpha_to[gg[j]];
+      for (k = 0; k < dataSize; k++)
+      {
+        for (j = 0; j < fecSize; j++)
+          parity.columns[j][k ^ 1] = row[j];
+        const auto feedback{gf.index_of[row[fecSize - 1]]};
+        for (j = fecSize - 1; j > 0; j--)
+          row[j] = row[j - 1] ^ gf.alpha_to[gg[j] + feedback];
+        row[0] = gf.alpha_to[gg[0] + feedback];
+      }
+    }
+
+    /// @brief Parity matrix shared by all the codecs of the same code, built on first use by the Arithmetic::CarryLess
+    ///        encoder, by FEC updates of symbols of more than 8 bits or by the zero run jumps of the shifting encoders
+    ///        (see useZeroRuns)
+    /// @note Kept in zero initialized storage as RS(65535,65519) takes 2 MB
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    inline const ParityColumns<BitsPerSymbol, AmountOfCorrectableSymbols> &parity_columns()
+    {
+      static ParityColumns<BitsPerSymbol, AmountOfCorrectableSymbols> parity;
+      static const bool built{(generate_parity_columns(parity), true)};
+      static_cast<void>(built);
+      return parity;
+    }
+
+    /// @brief Parity kernel: parity[j] = sum of data[k] * columns[j * stride + (k ^ 1)] for k < size, j < count
+    /// @note count is even, columns are zero padded to whole blocks of 16 symbols
+    using CarryLessParityKernel = void (*)(uint16_t *parity, const uint16_t *data, std::size_t size, const CarryLessField &field, const uint16_t *columns, std::size_t stride, std::size_t count);
+
+#ifdef REEDSOLOMON_X86_SIMD
+    __attribute__((target("pclmul,sse4.1"))) inline void carry_less_parity_pclmul(uint16_t *parity, const uint16_t *data, std::size_t size, const CarryLessField &field, const uint16_t *columns, std::size_t stride, std::size_t count)
+    /* every parity symbol is an independent dot product of data[] with its
+       column. Spread to 32 bit spacing, data[k], data[k+1] times the column
+       pair swapped holds data[k]*c[k] + data[k+1]*c[k+1] at bits 32..62 of
+       the carry-less product, the cross terms falling at bits 0..30 and
+       64..94. Products are summed unreduced, then reduced once. Columns go
+       by pairs to share the data loads.
+    */
+    {
+      const std::size_t blocks{(size + 15U) / 16U};
+      uint16_t padded[16];
+
+      for (std::size_t j{0U}; j < count; j += 2U)
+      {
+        const uint16_t *const column[2] = {columns + j * stride, columns + (j + 1U) * stride};
+        __m128i acc[2] = {_mm_setzero_si128(), _mm_setzero_si128()};
+        for (std::size_t q{0U}; q < blocks; q++)
+        {
+          const uint16_t *const block{symbol_block(data, size, q, padded)};
+          for (std::size_t k{0U}; k < 16U; k += 4U)
+          {
+            const __m128i d{_mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(block + k)))};
+            for (std::size_t c{0U}; c < 2U; c++)
+            {
+              const __m128i p{_mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(column[c] + 16U * q + k)))};
+              acc[c] = _mm_xor_si128(acc[c], _mm_xor_si128(_mm_clmulepi64_si128(d, p, 0x00), _mm_clmulepi64_si128(d, p, 0x11)));
+            }
+          }
+        }
+        for (std::size_t c{0U}; c < 2U; c++)
+          parity[j + c] = static_cast<uint16_t>(carry_less_reduce(static_cast<uint64_t>(_mm_cvtsi128_si64(acc[c])) >> 32, field));
+      }
+    }
+
+    __attribute__((target("vpclmulqdq,pclmul,avx512f"))) inline void carry_less_parity_avx512(uint16_t *parity, const uint16_t *data, std::size_t size, const CarryLessField &field, const uint16_t *columns, std::size_t stride, std::size_t count)
+    /* carry_less_parity_pclmul() with a whole block in one register */
+    {
+      const std::size_t blocks{(size + 15U) / 16U};
+      uint16_t padded[16];
+
+      for (std::size_t j{0U}; j < count; j += 2U)
+      {
+        const uint16_t *const column[2] = {columns + j * stride, columns + (j + 1U) * stride};
+        __m512i acc[2] = {_mm512_setzero_si512(), _mm512_setzero_si512()};
+        for (std::size_t q{0U}; q < blocks; q++)
+        {
+          const __m512i d{_mm512_maskz_cvtepu16_epi32(0xFFFFU, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(symbol_block(data, size, q, padded))))};
+          for (std::size_t c{0U}; c < 2U; c++)
+          {
+            const __m512i p{_mm512_maskz_cvtepu16_epi32(0xFFFFU, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(column[c] + 16U * q)))};
+            acc[c] = _mm512_xor_si512(acc[c], _mm512_xor_si512(_mm512_clmulepi64_epi128(d, p, 0x00), _mm512_clmulepi64_epi128(d, p, 0x11)));
+          }
+        }
+        for (std::size_t c{0U}; c < 2U; c++)
+        {
+          alignas(64) uint64_t lanes[8];
+          _mm512_store_si512(lanes, acc[c]);
+          const uint64_t sum{lanes[0] ^ lanes[2] ^ lanes[4] ^ lanes[6]};
+          parity[j + c] = static_cast<uint16_t>(carry_less_reduce(sum >> 32, field));
+        }
+      }
+    }
+#endif
+
+    /// @brief Pick the carry-less parity kernel for the CPU
+    /// @return nullptr when there is no carry-less multiply instruction, the LFSR being faster than software multiplies
+    inline CarryLessParityKernel select_carry_less_parity_kernel()
+    {
+#ifdef REEDSOLOMON_X86_SIMD
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("vpclmulqdq") && __builtin_cpu_supports("avx512f"))
+        return carry_less_parity_avx512;
+      if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1"))
+        return carry_less_parity_pclmul;
+#endif
+      return nullptr;
+    }
+
+    /// @brief Carry-less parity kernel picked on first use
+    inline CarryLessParityKernel carry_less_parity_kernel()
+    {
+      static const CarryLessParityKernel kernel{select_carry_less_parity_kernel()};
+      return kernel;
+    }
+
+    /// @brief GF(2**16) as GF((2**8)**2) = GF(2**8)[y]/(y**2 + y + lambda), a1*y + a0 held with a1 in the high byte
+    struct CompositeField
+    {
+      /// @brief Constant term of the extension polynomial y**2 + y + lambda
+      uint8_t lambda;
+
+      /// @brief Isomorphism from the polynomial basis by nibbles, byte b (0 the constant, 1 the y coefficient)
+      ///        of the image of x is the sum of to[k][b][(x >> 4*k) & 0xF] for k = 0..3
+      std::array<std::array<std::array<uint8_t, 16U>, 2U>, 4U> to;
+
+      /// @brief Inverse isomorphism, the image of c is from[0][c & 0xFF] ^ from[1][c >> 8]
+      std::array<std::array<uint16_t, 256U>, 2U> from;
+    };
+
+    /// @brief Product of a and b in GF(2**8), both in polynomial form
+    constexpr uint8_t gf256_multiply(uint8_t a, uint8_t b)
+    {
+      constexpr auto &gf{galois_field<8U>};
+      return gf.alpha_to[gf.index_of[a] + gf.index_of[b]];
+    }
+
+    /// @brief Product of a and b in GF((2**8)**2)
+    constexpr uint16_t composite_multiply(uint16_t a, uint16_t b, uint8_t lambda)
+    /* (a1*y + a0)(b1*y + b0) = (a1*b1 + a1*b0 + a0*b1)*y + a0*b0 + lambda*a1*b1
+       as y**2 = y + lambda, the middle term by Karatsuba (a1 + a0)(b1 + b0) + a0*b0
+    */
+    {
+      const uint8_t a1{static_cast<uint8_t>(a >> 8)}, a0{static_cast<uint8_t>(a)};
+      const uint8_t b1{static_cast<uint8_t>(b >> 8)}, b0{static_cast<uint8_t>(b)};
+      const uint8_t high{gf256_multiply(a1, b1)}, low{gf256_multiply(a0, b0)};
+      return static_cast<uint16_t>(((gf256_multiply(a1 ^ a0, b1 ^ b0) ^ low) << 8) | (low ^ gf256_multiply(lambda, high)));
+    }
+
+    /// @brief Map a GF(2**16) symbol from the polynomial basis to GF((2**8)**2)
+    constexpr uint16_t composite_from_polynomial(const CompositeField &field, uint16_t x)
+    {
+      uint16_t c{0U};
+      for (int k{0}; k < 4; k++)
+        c ^= field.to[k][0][(x >> (4 * k)) & 0x0FU] | (field.to[k][1][(x >> (4 * k)) & 0x0FU] << 8);
+      return c;
+    }
+
+    /// @brief Map a GF((2**8)**2) element back to the polynomial basis of GF(2**16)
+    constexpr uint16_t composite_to_polynomial(const CompositeField &field, uint16_t c)
+    {
+      return field.from[0][c & 0xFFU] ^ field.from[1][c >> 8];
+    }
+
+    /// @brief y**2 + y + lambda is irreducible over GF(2**8) for lambda of trace 1, the least one is 32
+    static constexpr uint8_t CompositeLambda{32U};
+
+    /// @brief Least root of the GF(2**16) field polynomial p(X) in GF((2**8)**2), searching it at compile time exceeds the constexpr limits
+    static constexpr uint16_t CompositeRoot{0x56BFU};
+
+    /// @brief Trace of x over GF(2), the sum of x**(2**i) for i = 0..7
+    constexpr uint8_t gf256_trace(uint8_t x)
+    {
+      uint8_t trace{0U};
+      for (int i{0}; i < 8; i++)
+      {
+        trace ^= x;
+        x = gf256_multiply(x, x);
+      }
+      return trace;
+    }
+
+    /// @brief Field polynomial p(X) of GF(2**BitsPerSymbol) evaluated at x of GF((2**8)**2) by Horner's rule
+    template <uint8_t BitsPerSymbol>
+    constexpr uint16_t composite_field_poly(uint16_t x)
+    {
+      constexpr auto pp{primitive_poly<BitsPerSymbol>()};
+      uint16_t value{0U};
+      for (int i{BitsPerSymbol}; i >= 0; i--)
+        value = composite_multiply(value, x, CompositeLambda) ^ pp[i];
+      return value;
+    }
+
+    template <uint8_t BitsPerSymbol>
+    constexpr CompositeField generate_composite_field()
+    /* the isomorphism takes alpha to the root omega of p(X), i.e. bit k of a
+       symbol to omega**k, and is inverted by Gauss-Jordan elimination
+    */
+    {
+      static_assert(gf256_trace(CompositeLambda) == 1U, "The extension polynomial is reducible");
+      static_assert(composite_field_poly<BitsPerSymbol>(CompositeRoot) == 0U, "The isomorphism does not map alpha to a root of p(X)");
+      CompositeField field{CompositeLambda, {}, {}};
+      uint16_t column[16] = {}, preimage[16] = {};
+      int i{0}, k{0}, x{0};
+
+      column[0] = 1U;
+      for (k = 1; k < 16; k++)
+        column[k] = composite_multiply(column[k - 1], CompositeRoot, field.lambda);
+      for (k = 0; k < 16; k++)
+        for (x = 0; x < 16; x++)
+          if ((x >> (k & 3)) & 1)
+          {
+            field.to[k >> 2][0][x] ^= static_cast<uint8_t>(column[k]);
+            field.to[k >> 2][1][x] ^= static_cast<uint8_t>(column[k] >> 8);
+          }
+      for (k = 0; k < 16; k++)
+        preimage[k] = static_cast<uint16_t>(1U << k);
+      for (k = 0; k < 16; k++) /* reduce the columns to the unit vectors, column[k] = 1 << k */
+      {
+        for (i = k; ((column[i] >> k) & 1U) == 0U; i++)
+          ;
+        const uint16_t pivot[2] = {column[i], preimage[i]};
+        column[i] = column[k];
+        preimage[i] = preimage[k];
+        column[k] = pivot[0];
+        preimage[k] = pivot[1];
+        for (i = 0; i < 16; i++)
+          if ((i != k) && ((column[i] >> k) & 1U))
+          {
+            column[i] ^= column[k];
+            preimage[i] ^= preimage[k];
+          }
+      }
+      for (k = 0; k < 16; k++)
+        for (x = 0; x < 256; x++)
+          if ((x >> (k & 7)) & 1)
+            field.from[k >> 3][x] ^= preimage[k];
+
+      return field;
+    }
+
+    /// @brief Composite field shared by all the codecs using Arithmetic::Composite
+    template <uint8_t BitsPerSymbol>
+    inline constexpr CompositeField composite_field{generate_composite_field<BitsPerSymbol>()};
+
+    /// @brief Powers of alpha**i in GF((2**8)**2) used to evaluate the syndrome S(i) in 32 phases
+    struct CompositePowers
+    {
+      /// @brief Split nibble tables of the GF(2**8) multipliers making up the product by alpha**(32*i) = b1*y + b0,
+      ///        b1 + b0 and b1 times a1 and a0 give its y coefficient, lambda*b1 and b0 times a1 and a0 its constant
+      std::array<std::array<uint8_t, 32U>, 4U> step;
+
+      /// @brief alpha**(i*p), p = 0..31
+      std::array<uint16_t, 32U> phase;
+    };
+
+    /// @brief Syndromes are computed in groups of 4 sharing the mapping of each block and overlapping their Horner chains
+    static constexpr std::size_t CompositeGroup{4U};
+
+    template <uint8_t AmountOfCorrectableSymbols>
+    using CompositePowersTable = std::array<CompositePowers, (2U * AmountOfCorrectableSymbols + CompositeGroup - 1U) / CompositeGroup * CompositeGroup>;
+
+    template <uint8_t AmountOfCorrectableSymbols>
+    constexpr CompositePowersTable<AmountOfCorrectableSymbols> generate_composite_powers()
+    /* entries past 2*tt only pad the last group and are never used */
+    {
+      constexpr auto &gf{galois_field<16U>};
+      constexpr auto &field{composite_field<16U>};
+      constexpr auto &multipliers{constant_multipliers<8U>};
+      CompositePowersTable<AmountOfCorrectableSymbols> powers{};
+      int i{0}, p{0};
+
+      for (i = 1; i <= 2 * AmountOfCorrectableSymbols; i++)
+      {
+        auto &power{powers[i - 1]};
+        const uint16_t step{composite_from_polynomial(field, gf.alpha_to[GaloisField<16U>::modnn(32 * i)])};
+        const uint8_t b1{static_cast<uint8_t>(step >> 8)}, b0{static_cast<uint8_t>(step)};
+        power.step = {multipliers.nibbles[b1 ^ b0], multipliers.nibbles[b1], multipliers.nibbles[gf256_multiply(field.lambda, b1)], multipliers.nibbles[b0]};
+        for (p = 0; p < 32; p++)
+          power.phase[p] = composite_from_polynomial(field, gf.alpha_to[GaloisField<16U>::modnn(i * p)]);
+      }
+
+      return powers;
+    }
+
+    /// @brief Syndrome powers shared by all the codecs of the same code using Arithmetic::Composite
+    template <uint8_t AmountOfCorrectableSymbols>
+    inline constexpr CompositePowersTable<AmountOfCorrectableSymbols> composite_powers{generate_composite_powers<AmountOfCorrectableSymbols>()};
+
+    /// @brief Syndromes kernel: syndromes[i] = r(alpha**(i+1)) for i < count, r[0..size) and the syndromes in polynomial form
+    /// @note powers holds count entries rounded up to CompositeGroup
+    using CompositeSyndromesKernel = void (*)(uint16_t *syndromes, const uint16_t *r, std::size_t size, const CompositeField &field, const CompositePowers *powers, std::size_t count);
+
+#ifdef REEDSOLOMON_X86_SIMD
+    __attribute__((target("avx2"))) inline void composite_syndromes_avx2(uint16_t *syndromes, const uint16_t *r, std::size_t size, const CompositeField &field, const CompositePowers *powers, std::size_t count)
+    /* r(X) is split in 32 phases evaluated at alpha**32i by Horner's rule as in
+       carry_less_syndromes_pclmul(), kept as a register of y coefficients and
+       one of constants. Each block is mapped to GF((2**8)**2) by nibble
+       shuffles and the product by alpha**32i takes four GF(2**8) constant
+       multiplications. The phases are weighted by alpha**ip, summed and
+       mapped back to the polynomial basis.
+    */
+    {
+      const std::size_t blocks{(size + 31U) / 32U};
+      const __m256i mask{_mm256_set1_epi8(0x0F)};
+      const __m256i lowBytes{_mm256_set1_epi16(0x00FF)};
+      __m256i to[4][2];
+      uint16_t padded[32];
+
+      for (std::size_t k{0U}; k < 4U; k++)
+        for (std::size_t b{0U}; b < 2U; b++)
+          to[k][b] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(field.to[k][b].data())));
+      for (std::size_t i{0U}; i < count; i += CompositeGroup)
+      {
+        __m256i high[CompositeGroup], low[CompositeGroup];
+        for (std::size_t g{0U}; g < CompositeGroup; g++)
+          high[g] = low[g] = _mm256_setzero_si256();
+        for (std::size_t q{blocks}; q-- > 0U;)
+        {
+          const uint16_t *const block{symbol_block(r, size, q, padded)};
+          const __m256i first{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(block))};
+          const __m256i second{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + 16U))};
+          const __m256i bytes[2] = {_mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_and_si256(first, lowBytes), _mm256_and_si256(second, lowBytes)), 0xD8),
+                                    _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_srli_epi16(first, 8), _mm256_srli_epi16(second, 8)), 0xD8)};
+          __m256i terms[2] = {_mm256_setzero_si256(), _mm256_setzero_si256()};
+          for (std::size_t k{0U}; k < 4U; k++)
+          {
+            const __m256i nibble{_mm256_and_si256((k & 1U) ? _mm256_srli_epi16(bytes[k >> 1], 4) : bytes[k >> 1], mask)};
+            for (std::size_t b{0U}; b < 2U; b++)
+              terms[b] = _mm256_xor_si256(terms[b], _mm256_shuffle_epi8(to[k][b], nibble));
+          }
+          for (std::size_t g{0U}; g < CompositeGroup; g++)
+          {
+            __m256i step[4][2];
+            for (std::size_t m{0U}; m < 4U; m++)
+              for (std::size_t h{0U}; h < 2U; h++)
+                step[m][h] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(powers[i + g].step[m].data() + 16U * h)));
+            const __m256i y{_mm256_xor_si256(_mm256_xor_si256(mul_avx2(high[g], step[0][0], step[0][1]), mul_avx2(low[g], step[1][0], step[1][1])), terms[1])};
+            low[g] = _mm256_xor_si256(_mm256_xor_si256(mul_avx2(high[g], step[2][0], step[2][1]), mul_avx2(low[g], step[3][0], step[3][1])), terms[0]);
+            high[g] = y;
+          }
+        }
+        for (std::size_t g{0U}; (g < CompositeGroup) && (i + g < count); g++)
+        {
+          uint8_t y[32], constant[32];
+          uint16_t sum{0U};
+          _mm256_storeu_si256(reinterpret_cast<__m256i *>(y), high[g]);
+          _mm256_storeu_si256(reinterpret_cast<__m256i *>(constant), low[g]);
+          for (std::size_t p{0U}; p < 32U; p++)
+            sum ^= composite_multiply(static_cast<uint16_t>((y[p] << 8) | constant[p]), powers[i + g].phase[p], field.lambda);
+          syndromes[i + g] = composite_to_polynomial(field, sum);
+        }
+      }
+    }
+#endif
+
+    /// @brief Pick the composite field syndromes kernel for the CPU
+    /// @return nullptr without AVX2, scalar GF((2**8)**2) arithmetic being slower than the GF(2**16) tables
+    inline CompositeSyndromesKernel select_composite_syndromes_kernel()
+    {
+#ifdef REEDSOLOMON_X86_SIMD
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2"))
+        return composite_syndromes_avx2;
+#endif
+      return nullptr;
+    }
+
+    /// @brief Composite field syndromes kernel picked on first use
+    inline CompositeSyndromesKernel composite_syndromes_kernel()
+    {
+      static const CompositeSyndromesKernel kernel{select_composite_syndromes_kernel()};
+      return kernel;
+    }
+
+    /// @brief Transpose the 8x8 bit-matrix whose row i is byte i of x
+    constexpr uint64_t transpose_bits(uint64_t x)
+    {
+      uint64_t t{(x ^ (x >> 7)) & 0x00AA00AA00AA00AAU};
+      x ^= t ^ (t << 7);
+      t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCU;
+      x ^= t ^ (t << 14);
+      t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0U;
+      return x ^ t ^ (t << 28);
+    }
+
+#if defined(REEDSOLOMON_X86_SIMD) && defined(__SSE2__)
+    /// @brief Bitslice positions j..j+7 of 8 lanes, the group g of bitslice()
+    template <uint8_t BitsPerSymbol, typename Word>
+    inline void bitslice_block(Word (*planes)[BitsPerSymbol], const uint8_t *symbols, std::size_t stride, std::size_t g)
+    /* the 8x8 symbols are loaded 2 lanes a register and transposed by unpacking so
+       that each register holds 2 positions of the 8 lanes, then bit b of
+       every byte is gathered by a shift and a byte sign mask
+    */
+    {
+      __m128i rows[4], pairs[4], quads[4], columns[4];
+
+      for (std::size_t l{0U}; l < 4U; l++)
+        rows[l] = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(symbols + 2U * l * stride)),
+                                     _mm_loadl_epi64(reinterpret_cast<const __m128i *>(symbols + (2U * l + 1U) * stride)));
+      for (std::size_t l{0U}; l < 2U; l++)
+      {
+        pairs[2U * l] = _mm_unpacklo_epi8(rows[2U * l], rows[2U * l + 1U]);
+        pairs[2U * l + 1U] = _mm_unpackhi_epi8(rows[2U * l], rows[2U * l + 1U]);
+        quads[2U * l] = _mm_unpacklo_epi8(pairs[2U * l], pairs[2U * l + 1U]);
+        quads[2U * l + 1U] = _mm_unpackhi_epi8(pairs[2U * l], pairs[2U * l + 1U]);
+      }
+      columns[0] = _mm_unpacklo_epi32(quads[0], quads[2]);
+      columns[1] = _mm_unpackhi_epi32(quads[0], quads[2]);
+      columns[2] = _mm_unpacklo_epi32(quads[1], quads[3]);
+      columns[3] = _mm_unpackhi_epi32(quads[1], quads[3]);
+      for (std::size_t q{0U}; q < 4U; q++)
+        for (std::size_t b{0U}; b < BitsPerSymbol; b++)
+        {
+          const int mask{_mm_movemask_epi8(_mm_slli_epi64(columns[q], static_cast<int>(7U - b)))};
+          reinterpret_cast<uint8_t *>(&planes[2U * q][b])[g] = static_cast<uint8_t>(mask);
+          reinterpret_cast<uint8_t *>(&planes[2U * q + 1U][b])[g] = static_cast<uint8_t>(mask >> 8);
+        }
+    }
+#endif
+
+    /// @brief Gather the symbols symbols[l*stride + j] of lanes l < lanes into bit-planes, planes[j][b] holding bit b
+    ///        of the symbol at position j < positions of every lane
+    /// @note Lane l is bit l%8 of byte l/8 of each plane, the layout only matters to unbitslice()
+    template <uint8_t BitsPerSymbol, typename Word>
+    inline void bitslice(Word (*planes)[BitsPerSymbol], const uint8_t *symbols, std::size_t stride, std::size_t positions, std::size_t lanes)
+    {
+      for (std::size_t j{0U}; j < positions; j++)
+        for (std::size_t b{0U}; b < BitsPerSymbol; b++)
+          planes[j][b] = Word{};
+      for (std::size_t g{0U}; 8U * g < lanes; g++)
+      {
+        const uint8_t *const group{symbols + 8U * g * stride};
+        std::size_t j{0U};
+#if defined(REEDSOLOMON_X86_SIMD) && defined(__SSE2__)
+        if (8U * g + 8U <= lanes)
+          for (; j + 8U <= positions; j += 8U)
+            bitslice_block(planes + j, group + j, stride, g);
+#endif
+        for (; j < positions; j++)
+        {
+          uint64_t x{0U};
+          for (std::size_t l{0U}; (l < 8U) && (8U * g + l < lanes); l++)
+            x |= uint64_t{group[l * stride + j]} << (8U * l);
+          x = transpose_bits(x);
+          for (std::size_t b{0U}; b < BitsPerSymbol; b++)
+            reinterpret_cast<uint8_t *>(&planes[j][b])[g] = static_cast<uint8_t>(x >> (8U * b));
+        }
+      }
+    }
+
+    /// @brief Scatter bit-planes back to the symbols symbols[l*stride] of lanes l < lanes, see bitslice()
+    template <uint8_t BitsPerSymbol, typename Word>
+    inline void unbitslice(const Word (&planes)[BitsPerSymbol], uint8_t *symbols, std::size_t stride, std::size_t lanes)
+    {
+      for (std::size_t g{0U}; 8U * g < lanes; g++)
+      {
+        uint64_t x{0U};
+        for (std::size_t b{0U}; b < BitsPerSymbol; b++)
+          x |= uint64_t{reinterpret_cast<const uint8_t *>(&planes[b])[g]} << (8U * b);
+        x = transpose_bits(x);
+        for (std::size_t l{0U}; (l < 8U) && (8U * g + l < lanes); l++)
+          symbols[(8U * g + l) * stride] = static_cast<uint8_t>(x >> (8U * l));
+      }
+    }
+
+    /// @brief Bit-matrix of the multiplication by c (polynomial form), bit i*BitsPerSymbol + j set when bit i of c*alpha**j is
+    template <uint8_t BitsPerSymbol>
+    constexpr uint64_t bitsliced_matrix(int c)
+    {
+      constexpr auto &gf{galois_field<BitsPerSymbol>};
+      uint64_t matrix{0U};
+      int i{0}, j{0};
+
+      for (j = 0; j < BitsPerSymbol; j++)
+      {
+        const int column{gf.alpha_to[gf.index_of[c] + j]};
+        for (i = 0; i < BitsPerSymbol; i++)
+          if ((column >> i) & 1)
+            matrix |= uint64_t{1U} << (i * BitsPerSymbol + j);
+      }
+
+      return matrix;
+    }
+
+    /// @brief Bit-matrices of the multiplications used by the bitsliced encoder and syndromes
+    template <uint8_t AmountOfCorrectableSymbols>
+    struct BitslicedMatrices
+    {
+      /// @brief Generator polynomial coefficients gg[0..2*tt-1]
+      std::array<uint64_t, 2U * AmountOfCorrectableSymbols> generator;
+
+      /// @brief alpha**i, i = 1..2*tt
+      std::array<uint64_t, 2U * AmountOfCorrectableSymbols> powers;
+    };
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    constexpr BitslicedMatrices<AmountOfCorrectableSymbols> generate_bitsliced_matrices()
+    {
+      constexpr auto &gf{galois_field<BitsPerSymbol>};
+      constexpr auto gg{gen_poly<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+      BitslicedMatrices<AmountOfCorrectableSymbols> matrices{};
+      int i{0};
+
+      for (i = 0; i < 2 * AmountOfCorrectableSymbols; i++)
+      {
+        matrices.generator[i] = bitsliced_matrix<BitsPerSymbol>(gf.alpha_to[gg[i]]);
+        matrices.powers[i] = bitsliced_matrix<BitsPerSymbol>(gf.alpha_to[i + 1]);
+      }
+
+      return matrices;
+    }
+
+    /// @brief Bit-matrices shared by all the codecs of the same code
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    inline constexpr BitslicedMatrices<AmountOfCorrectableSymbols> bitsliced_matrices{generate_bitsliced_matrices<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+
+    /// @brief out ^= c*x on bit-planes, as the straight-line XORs picked at compile time by the bit-matrix of c
+    template <uint8_t BitsPerSymbol, uint64_t Matrix, typename Word, std::size_t... Bits>
+    inline void bitsliced_multiply_add(Word *out, const Word *x, std::index_sequence<Bits...>)
+    {
+      ((((Matrix >> Bits) & 1U) ? void(out[Bits / BitsPerSymbol] ^= x[Bits % BitsPerSymbol]) : void()), ...);
+    }
+
+    /// @brief One LFSR step of the encoder for every lane, see encode_rs()
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, typename Word, std::size_t... Taps>
+    inline void bitsliced_encode_step(Word (&bb)[2U * AmountOfCorrectableSymbols][BitsPerSymbol], const Word (&symbol)[BitsPerSymbol], std::index_sequence<Taps...>)
+    {
+      constexpr auto &matrices{bitsliced_matrices<BitsPerSymbol, AmountOfCorrectableSymbols>};
+      Word feedback[BitsPerSymbol];
+
+      for (std::size_t b{0U}; b < BitsPerSymbol; b++)
+        feedback[b] = symbol[b] ^ bb[2U * AmountOfCorrectableSymbols - 1U][b];
+      for (std::size_t j{2U * AmountOfCorrectableSymbols - 1U}; j > 0U; j--)
+        for (std::size_t b{0U}; b < BitsPerSymbol; b++)
+          bb[j][b] = bb[j - 1U][b];
+      for (std::size_t b{0U}; b < BitsPerSymbol; b++)
+        bb[0][b] = Word{};
+      (bitsliced_multiply_add<BitsPerSymbol, matrices.generator[Taps]>(bb[Taps], feedback, std::make_index_sequence<BitsPerSymbol * BitsPerSymbol>{}), ...);
+    }
+
+    /// @brief s = s*c + symbol for every lane
+    template <uint8_t BitsPerSymbol, uint64_t Matrix, typename Word>
+    inline void bitsliced_horner(Word (&s)[BitsPerSymbol], const Word (&symbol)[BitsPerSymbol])
+    {
+      Word next[BitsPerSymbol];
+
+      for (std::size_t b{0U}; b < BitsPerSymbol; b++)
+        next[b] = symbol[b];
+      bitsliced_multiply_add<BitsPerSymbol, Matrix>(next, s, std::make_index_sequence<BitsPerSymbol * BitsPerSymbol>{});
+      for (std::size_t b{0U}; b < BitsPerSymbol; b++)
+        s[b] = next[b];
+    }
+
+    /// @brief One Horner step of every syndrome for every lane
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, typename Word, std::size_t... Powers>
+    inline void bitsliced_syndromes_step(Word (&s)[2U * AmountOfCorrectableSymbols][BitsPerSymbol], const Word (&symbol)[BitsPerSymbol], std::index_sequence<Powers...>)
+    {
+      constexpr auto &matrices{bitsliced_matrices<BitsPerSymbol, AmountOfCorrectableSymbols>};
+      (bitsliced_horner<BitsPerSymbol, matrices.powers[Powers]>(s[Powers], symbol), ...);
+    }
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    using BatchMessage = std::array<typename GaloisField<BitsPerSymbol>::Symbol, GaloisField<BitsPerSymbol>::size - 2U * AmountOfCorrectableSymbols>;
+
+    template <uint8_t BitsPerSymbol>
+    using BatchCodeword = std::array<typename GaloisField<BitsPerSymbol>::Symbol, GaloisField<BitsPerSymbol>::size>;
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, typename Word>
+    inline void bitsliced_encode(const BatchMessage<BitsPerSymbol, AmountOfCorrectableSymbols> *messages, BatchCodeword<BitsPerSymbol> *codewords, std::size_t count)
+    /* every bit of a Word is a lane encoding its own codeword, a batch of
+       messages being transposed into bit-planes first. Taken in machine words
+       only, when the structure of arrays encoders are not available: with
+       AVX2 they outrun bitsliced vectors of 256 or 512 lanes 2 to 3 times
+    */
+    {
+      constexpr std::size_t fecSize{2U * AmountOfCorrectableSymbols};
+      constexpr std::size_t dataSize{GaloisField<BitsPerSymbol>::size - fecSize};
+      constexpr std::size_t lanes{8U * sizeof(Word)};
+
+      for (std::size_t first{0U}; first < count; first += lanes)
+      {
+        const std::size_t batch{(count - first < lanes) ? count - first : lanes};
+        Word data[dataSize][BitsPerSymbol];
+        Word bb[fecSize][BitsPerSymbol] = {};
+        bitslice(data, messages[first].data(), dataSize, dataSize, batch);
+        for (std::size_t i{dataSize}; i-- > 0U;)
+          bitsliced_encode_step<BitsPerSymbol, AmountOfCorrectableSymbols>(bb, data[i], std::make_index_sequence<fecSize>{});
+        for (std::size_t l{0U}; l < batch; l++)
+          for (std::size_t i{0U}; i < dataSize; i++)
+            codewords[first + l][i] = messages[first + l][i];
+        for (std::size_t j{0U}; j < fecSize; j++)
+          unbitslice(bb[j], &codewords[first][dataSize + j], GaloisField<BitsPerSymbol>::size, batch);
+      }
+    }
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, typename Word>
+    inline void bitsliced_check(const BatchCodeword<BitsPerSymbol> *codewords, uint64_t *dirty, std::size_t count)
+    /* bit k of dirty[] gets set when codewords[k] has a non-zero syndrome,
+       the syndromes of every lane being evaluated by Horner's rule
+    */
+    {
+      constexpr std::size_t fecSize{2U * AmountOfCorrectableSymbols};
+      constexpr std::size_t lanes{8U * sizeof(Word)};
+
+      for (std::size_t first{0U}; first < count; first += lanes)
+      {
+        const std::size_t batch{(count - first < lanes) ? count - first : lanes};
+        Word recd[GaloisField<BitsPerSymbol>::size][BitsPerSymbol];
+        Word s[fecSize][BitsPerSymbol] = {};
+        Word nonzero{};
+        bitslice(recd, codewords[first].data(), GaloisField<BitsPerSymbol>::size, GaloisField<BitsPerSymbol>::size, batch);
+        for (std::size_t j{GaloisField<BitsPerSymbol>::size}; j-- > 0U;)
+          bitsliced_syndromes_step<BitsPerSymbol, AmountOfCorrectableSymbols>(s, recd[j], std::make_index_sequence<fecSize>{});
+        for (std::size_t i{0U}; i < fecSize; i++)
+          for (std::size_t b{0U}; b < BitsPerSymbol; b++)
+            nonzero |= s[i][b];
+        for (std::size_t l{0U}; l < batch; l++)
+          if ((reinterpret_cast<const uint8_t *>(&nonzero)[l / 8U] >> (l % 8U)) & 1U)
+            dirty[(first + l) / 64U] |= uint64_t{1U} << ((first + l) % 64U);
+      }
+    }
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    using BatchEncodeKernel = void (*)(const BatchMessage<BitsPerSymbol, AmountOfCorrectableSymbols> *messages, BatchCodeword<BitsPerSymbol> *codewords, std::size_t count);
+
+    template <uint8_t BitsPerSymbol>
+    using BitslicedCheckKernel = void (*)(const BatchCodeword<BitsPerSymbol> *codewords, uint64_t *dirty, std::size_t count);
+
+#ifdef REEDSOLOMON_X86_SIMD
+    /// @brief 256 and 512 lanes of bitsliced codewords
+    using BitslicedWord256 = uint64_t __attribute__((vector_size(32)));
+    using BitslicedWord512 = uint64_t __attribute__((vector_size(64)));
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    __attribute__((target("avx2"), flatten)) inline void bitsliced_check_avx2(const BatchCodeword<BitsPerSymbol> *codewords, uint64_t *dirty, std::size_t count)
+    {
+      bitsliced_check<BitsPerSymbol, AmountOfCorrectableSymbols, BitslicedWord256>(codewords, dirty, count);
+    }
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    __attribute__((target("avx512f"), flatten)) inline void bitsliced_check_avx512(const BatchCodeword<BitsPerSymbol> *codewords, uint64_t *dirty, std::size_t count)
+    {
+      bitsliced_check<BitsPerSymbol, AmountOfCorrectableSymbols, BitslicedWord512>(codewords, dirty, count);
+    }
+#endif
+
+    /// @brief Pick the widest bitsliced syndrome check for the CPU, 512, 256 or 64 lanes
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    inline BitslicedCheckKernel<BitsPerSymbol> select_bitsliced_check_kernel()
+    {
+#ifdef REEDSOLOMON_X86_SIMD
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f"))
+        return bitsliced_check_avx512<BitsPerSymbol, AmountOfCorrectableSymbols>;
+      if (__builtin_cpu_supports("avx2"))
+        return bitsliced_check_avx2<BitsPerSymbol, AmountOfCorrectableSymbols>;
+#endif
+      return bitsliced_check<BitsPerSymbol, AmountOfCorrectableSymbols, uint64_t>;
+    }
+
+    /// @brief Bitsliced syndrome check picked on first use
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    inline BitslicedCheckKernel<BitsPerSymbol> bitsliced_check_kernel()
+    {
+      static const BitslicedCheckKernel<BitsPerSymbol> kernel{select_bitsliced_check_kernel<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+      return kernel;
+    }
+
+#ifdef REEDSOLOMON_X86_SIMD
+    /// @brief Structure of arrays lanes of 32 codewords, taps multiplied by split nibble shuffles
+    /// @note Vectors are passed by reference, as soa_encode() is only given the ISA by its flattened callers
+    struct SoaAvx2
+    {
+      using Vector = __m256i;
+
+      /// @brief Low and high nibbles of the feedback, or the products of a tap by every nibble
+      struct Nibbles
+      {
+        __m256i lo;
+        __m256i hi;
+      };
+
+      using Tap = Nibbles;
+      using Feedback = Nibbles;
+
+      __attribute__((target("avx2"))) static void tap(Tap &t, const ConstantMultipliers &multipliers, uint8_t c)
+      {
+        t.lo = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(multipliers.nibbles[c].data())));
+        t.hi = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(multipliers.nibbles[c].data() + 16U)));
+      }
+
+      __attribute__((target("avx2"))) static void zero(Vector &x)
+      {
+        x = _mm256_setzero_si256();
+      }
+
+      __attribute__((target("avx2"))) static void store(uint8_t *p, const Vector &x)
+      {
+        _mm256_store_si256(reinterpret_cast<__m256i *>(p), x);
+      }
+
+      /// @brief Feedback of the data symbols p[] and the top of the registers
+      __attribute__((target("avx2"))) static void feedback(Feedback &f, const uint8_t *p, const Vector &top)
+      {
+        const __m256i mask{_mm256_set1_epi8(0x0F)};
+        const __m256i x{_mm256_xor_si256(_mm256_load_si256(reinterpret_cast<const __m256i *>(p)), top)};
+        f.lo = _mm256_and_si256(x, mask);
+        f.hi = _mm256_and_si256(_mm256_srli_epi64(x, 4), mask);
+      }
+
+      /// @brief bb = below + f*c
+      __attribute__((target("avx2"))) static void shift(Vector &bb, const Vector &below, const Feedback &f, const Tap &c)
+      {
+        bb = _mm256_xor_si256(below, _mm256_xor_si256(_mm256_shuffle_epi8(c.lo, f.lo), _mm256_shuffle_epi8(c.hi, f.hi)));
+      }
+    };
+
+    /// @brief Structure of arrays lanes of 64 codewords, taps multiplied by split nibble shuffles
+    /// @note As in mul_avx512bw() zero masking forms with all lanes set avoid -Wmaybe-uninitialized on GCC
+    struct SoaAvx512bw
+    {
+      using Vector = __m512i;
+
+      struct Nibbles
+      {
+        __m512i lo;
+        __m512i hi;
+      };
+
+      using Tap = Nibbles;
+      using Feedback = Nibbles;
+
+      __attribute__((target("avx512bw"))) static void tap(Tap &t, const ConstantMultipliers &multipliers, uint8_t c)
+      {
+        t.lo = _mm512_maskz_broadcast_i32x4(0xFFFFU, _mm_loadu_si128(reinterpret_cast<const __m128i *>(multipliers.nibbles[c].data())));
+        t.hi = _mm512_maskz_broadcast_i32x4(0xFFFFU, _mm_loadu_si128(reinterpret_cast<const __m128i *>(multipliers.nibbles[c].data() + 16U)));
+      }
+
+      __attribute__((target("avx512bw"))) static void zero(Vector &x)
+      {
+        x = _mm512_setzero_si512();
+      }
+
+      __attribute__((target("avx512bw"))) static void store(uint8_t *p, const Vector &x)
+      {
+        _mm512_store_si512(p, x);
+      }
+
+      __attribute__((target("avx512bw"))) static void feedback(Feedback &f, const uint8_t *p, const Vector &top)
+      {
+        const __m512i mask{_mm512_set1_epi8(0x0F)};
+        const __m512i x{_mm512_xor_si512(_mm512_load_si512(p), top)};
+        f.lo = _mm512_and_si512(x, mask);
+        f.hi = _mm512_and_si512(_mm512_maskz_srli_epi64(0xFFU, x, 4), mask);
+      }
+
+      __attribute__((target("avx512bw"))) static void shift(Vector &bb, const Vector &below, const Feedback &f, const Tap &c)
+      {
+        bb = _mm512_xor_si512(below, _mm512_xor_si512(_mm512_shuffle_epi8(c.lo, f.lo), _mm512_shuffle_epi8(c.hi, f.hi)));
+      }
+    };
+
+    /// @brief Structure of arrays lanes of 32 codewords, taps multiplied by GF2P8AFFINEQB
+    struct SoaGfniAvx2 : SoaAvx2
+    {
+      using Tap = __m256i;
+      using Feedback = __m256i;
+
+      __attribute__((target("gfni,avx2"))) static void tap(Tap &t, const ConstantMultipliers &multipliers, uint8_t c)
+      {
+        t = _mm256_set1_epi64x(static_cast<long long>(multipliers.affine[c]));
+      }
+
+      __attribute__((target("gfni,avx2"))) static void feedback(Feedback &f, const uint8_t *p, const Vector &top)
+      {
+        f = _mm256_xor_si256(_mm256_load_si256(reinterpret_cast<const __m256i *>(p)), top);
+      }
+
+      __attribute__((target("gfni,avx2"))) static void shift(Vector &bb, const Vector &below, const Feedback &f, const Tap &c)
+      {
+        bb = _mm256_xor_si256(below, _mm256_gf2p8affine_epi64_epi8(f, c, 0));
+      }
+    };
+
+    /// @brief Structure of arrays lanes of 64 codewords, taps multiplied by GF2P8AFFINEQB
+    struct SoaGfniAvx512bw : SoaAvx512bw
+    {
+      using Tap = __m512i;
+      using Feedback = __m512i;
+
+      __attribute__((target("gfni,avx512bw"))) static void tap(Tap &t, const ConstantMultipliers &multipliers, uint8_t c)
+      {
+        t = _mm512_set1_epi64(static_cast<long long>(multipliers.affine[c]));
+      }
+
+      __attribute__((target("gfni,avx512bw"))) static void feedback(Feedback &f, const uint8_t *p, const Vector &top)
+      {
+        f = _mm512_xor_si512(_mm512_load_si512(p), top);
+      }
+
+      __attribute__((target("gfni,avx512bw"))) static void shift(Vector &bb, const Vector &below, const Feedback &f, const Tap &c)
+      {
+        bb = _mm512_xor_si512(below, _mm512_gf2p8affine_epi64_epi8(f, c, 0));
+      }
+    };
+
+    /// @brief One round of the 16x16 byte transposition, 4 rounds of interleaving rows r and r+8 transpose it
+    template <std::size_t... Rows>
+    __attribute__((target("sse2"))) inline void soa_transpose_round(__m128i (&rows)[16], std::index_sequence<Rows...>)
+    {
+      const __m128i interleaved[16] = {((Rows % 2U) ? _mm_unpackhi_epi8(rows[Rows / 2U], rows[Rows / 2U + 8U]) : _mm_unpacklo_epi8(rows[Rows / 2U], rows[Rows / 2U + 8U]))...};
+      ((rows[Rows] = interleaved[Rows]), ...);
+    }
+
+    /// @brief Transpose 16 symbols of 16 lanes, lane l at symbols + l*stride, into dst[k*lanes + l]
+    __attribute__((target("sse2"))) inline void soa_transpose_block(uint8_t *dst, std::size_t lanes, const uint8_t *symbols, std::size_t stride)
+    {
+      __m128i rows[16];
+
+      for (std::size_t l{0U}; l < 16U; l++)
+        rows[l] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(symbols + l * stride));
+      for (std::size_t r{0U}; r < 4U; r++)
+        soa_transpose_round(rows, std::make_index_sequence<16U>{});
+      for (std::size_t k{0U}; k < 16U; k++)
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + k * lanes), rows[k]);
+    }
+
+    /// @brief One LFSR step of every lane, the taps unrolled so that the registers stay in vector registers
+    template <typename Lanes, std::size_t... Taps>
+    inline void soa_encode_step(typename Lanes::Vector *bb, const typename Lanes::Tap *taps, const uint8_t *data, const typename Lanes::Vector &zero, std::index_sequence<Taps...>)
+    {
+      constexpr std::size_t fecSize{sizeof...(Taps)};
+      typename Lanes::Feedback feedback;
+
+      Lanes::feedback(feedback, data, bb[fecSize - 1U]);
+      (Lanes::shift(bb[fecSize - 1U - Taps], (Taps + 1U < fecSize) ? bb[fecSize - 2U - Taps] : zero, feedback, taps[fecSize - 1U - Taps]), ...);
+    }
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, typename Lanes>
+    inline void soa_encode(const BatchMessage<BitsPerSymbol, AmountOfCorrectableSymbols> *messages, BatchCodeword<BitsPerSymbol> *codewords, std::size_t count)
+    /* every byte of a Lanes::Vector is a lane running the LFSR of its own
+       codeword, all the lanes sharing the taps, a batch of messages being
+       transposed into a structure of arrays first
+    */
+    {
+      constexpr auto &gf{galois_field<BitsPerSymbol>};
+      constexpr auto gg{gen_poly<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+      constexpr std::size_t fecSize{2U * AmountOfCorrectableSymbols};
+      constexpr std::size_t dataSize{GaloisField<BitsPerSymbol>::size - fecSize};
+      constexpr std::size_t lanes{sizeof(typename Lanes::Vector)};
+      typename Lanes::Tap taps[fecSize];
+      typename Lanes::Vector zero;
+
+      for (std::size_t j{0U}; j < fecSize; j++)
+        Lanes::tap(taps[j], constant_multipliers<BitsPerSymbol>, static_cast<uint8_t>(gf.alpha_to[gg[j]]));
+      Lanes::zero(zero);
+      for (std::size_t first{0U}; first < count; first += lanes)
+      {
+        const std::size_t batch{(count - first < lanes) ? count - first : lanes};
+        alignas(64) uint8_t data[dataSize][lanes];
+        alignas(64) uint8_t parity[fecSize][lanes];
+        typename Lanes::Vector bb[fecSize];
+        std::size_t i{0U};
+        if (batch == lanes) /* whole blocks of 16x16 symbols, the rest one by one */
+          for (; i + 16U <= dataSize; i += 16U)
+            for (std::size_t l{0U}; l < lanes; l += 16U)
+              soa_transpose_block(&data[i][l], lanes, messages[first + l].data() + i, sizeof(messages[0]));
+        for (; i < dataSize; i++)
+          for (std::size_t l{0U}; l < lanes; l++)
+            data[i][l] = (l < batch) ? messages[first + l][i] : 0U;
+        for (std::size_t j{0U}; j < fecSize; j++)
+          bb[j] = zero;
+        for (i = dataSize; i-- > 0U;)
+          soa_encode_step<Lanes>(bb, taps, data[i], zero, std::make_index_sequence<fecSize>{});
+        for (std::size_t j{0U}; j < fecSize; j++)
+          Lanes::store(parity[j], bb[j]);
+        for (std::size_t l{0U}; l < batch; l++)
+        {
+          memcpy(codewords[first + l].data(), messages[first + l].data(), sizeof(messages[0]));
+          for (std::size_t j{0U}; j < fecSize; j++)
+            codewords[first + l][dataSize + j] = parity[j][l];
+        }
+      }
+    }
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    __attribute__((target("avx2"), flatten)) inline void soa_encode_avx2(const BatchMessage<BitsPerSymbol, AmountOfCorrectableSymbols> *messages, BatchCodeword<BitsPerSymbol> *codewords, std::size_t count)
+    {
+      soa_encode<BitsPerSymbol, AmountOfCorrectableSymbols, SoaAvx2>(messages, codewords, count);
+    }
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    __attribute__((target("avx512bw"), flatten)) inline void soa_encode_avx512bw(const BatchMessage<BitsPerSymbol, AmountOfCorrectableSymbols> *messages, BatchCodeword<BitsPerSymbol> *codewords, std::size_t count)
+    {
+      soa_encode<BitsPerSymbol, AmountOfCorrectableSymbols, SoaAvx512bw>(messages, codewords, count);
+    }
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    __attribute__((target("gfni,avx2"), flatten)) inline void soa_encode_gfni_avx2(const BatchMessage<BitsPerSymbol, AmountOfCorrectableSymbols> *messages, BatchCodeword<BitsPerSymbol> *codewords, std::size_t count)
+    {
+      soa_encode<BitsPerSymbol, AmountOfCorrectableSymbols, SoaGfniAvx2>(messages, codewords, count);
+    }
+
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    __attribute__((target("gfni,avx512bw"), flatten)) inline void soa_encode_gfni_avx512bw(const BatchMessage<BitsPerSymbol, AmountOfCorrectableSymbols> *messages, BatchCodeword<BitsPerSymbol> *codewords, std::size_t count)
+    {
+      soa_encode<BitsPerSymbol, AmountOfCorrectableSymbols, SoaGfniAvx512bw>(messages, codewords, count);
+    }
+#endif
+
+    /// @brief Pick the structure of arrays encoder for the CPU, GFNI first then the widest nibble shuffles
+    /// @return nullptr without AVX2, narrower lanes not paying for the transposition
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    inline BatchEncodeKernel<BitsPerSymbol, AmountOfCorrectableSymbols> select_soa_encode_kernel()
+    {
+#ifdef REEDSOLOMON_X86_SIMD
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("gfni"))
+      {
+        if (__builtin_cpu_supports("avx512bw"))
+          return soa_encode_gfni_avx512bw<BitsPerSymbol, AmountOfCorrectableSymbols>;
+        if (__builtin_cpu_supports("avx2"))
+          return soa_encode_gfni_avx2<BitsPerSymbol, AmountOfCorrectableSymbols>;
+      }
+      if (__builtin_cpu_supports("avx512bw"))
+        return soa_encode_avx512bw<BitsPerSymbol, AmountOfCorrectableSymbols>;
+      if (__builtin_cpu_supports("avx2"))
+        return soa_encode_avx2<BitsPerSymbol, AmountOfCorrectableSymbols>;
+#endif
+      return nullptr;
+    }
+
+    /// @brief Structure of arrays encoder picked on first use
+    template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+    inline BatchEncodeKernel<BitsPerSymbol, AmountOfCorrectableSymbols> soa_encode_kernel()
+    {
+      static const BatchEncodeKernel<BitsPerSymbol, AmountOfCorrectableSymbols> kernel{select_soa_encode_kernel<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+      return kernel;
+    }
+
+    /// @brief Bytes taken by count symbols packed BitsPerSymbol bits each, MSB first
+    template <uint8_t BitsPerSymbol>
+    constexpr std::size_t packed_size(std::size_t count)
+    {
+      return (count * BitsPerSymbol + 7U) / 8U;
+    }
+
+    /// @brief Unpack count symbols, symbol k taking bits k*BitsPerSymbol.. of the packed stream (MSB first)
+    template <uint8_t BitsPerSymbol>
+    inline void unpack_scalar(typename GaloisField<BitsPerSymbol>::Symbol *symbols, const uint8_t *packed, std::size_t count)
+    {
+      uint32_t bits{0U};
+      unsigned held{0U};
+
+      for (std::size_t k{0U}; k < count; k++)
+      {
+        while (held < BitsPerSymbol)
+        {
+          bits = (bits << 8) | *packed++;
+          held += 8U;
+        }
+        held -= BitsPerSymbol;
+        symbols[k] = static_cast<typename GaloisField<BitsPerSymbol>::Symbol>((bits >> held) & GaloisField<BitsPerSymbol>::size);
+      }
+    }
+
+    /// @brief Pack count symbols, see unpack_scalar(), the bits padding the last byte cleared
+    template <uint8_t BitsPerSymbol>
+    inline void pack_scalar(uint8_t *packed, const typename GaloisField<BitsPerSymbol>::Symbol *symbols, std::size_t count)
+    {
+      uint32_t bits{0U};
+      unsigned held{0U};
+
+      for (std::size_t k{0U}; k < count; k++)
+      {
+        bits = (bits << BitsPerSymbol) | (symbols[k] & GaloisField<BitsPerSymbol>::size);
+        held += BitsPerSymbol;
+        while (held >= 8U)
+        {
+          held -= 8U;
+          *packed++ = static_cast<uint8_t>(bits >> held);
+        }
+      }
+      if (held > 0U)
+      {
+        *packed = static_cast<uint8_t>(bits << (8U - held));
+      }
+    }
+
+    /// @brief Byte shuffles and shifts moving a group of 8 packed symbols (BitsPerSymbol bytes) to and from 32 bit lanes
+    struct PackLayout
+    {
+      /// @brief Bytes of the symbol of lane l, its first packed byte on top
+      std::array<uint8_t, 32U> gather;
+
+      /// @brief Left shifts dropping the bits of the previous symbols from the top of lane l
+      std::array<int32_t, 8U> unpackShifts;
+
+      /// @brief Left shifts moving the symbol of lane l under the bits of the previous symbols
+      std::array<int32_t, 8U> packShifts;
+
+      /// @brief Most lanes of a 128 bit half sharing a packed byte
+      std::size_t scatters;
+
+      /// @brief scatter[r] picks, for each packed byte, the byte of the r-th lane of the half sharing it
+      std::array<std::array<uint8_t, 32U>, 4U> scatter;
+    };
+
+    template <uint8_t BitsPerSymbol>
+    constexpr PackLayout generate_pack_layout()
+    {
+      PackLayout layout{};
+      std::size_t shared[2][16] = {};
+
+      for (auto &bytes : layout.scatter)
+        for (auto &byte : bytes)
+          byte = 0x80U;
+      for (std::size_t l{0U}; l < 8U; l++)
+      {
+        const std::size_t first{l * BitsPerSymbol / 8U}, last{((l + 1U) * BitsPerSymbol - 1U) / 8U}, half{l / 4U};
+        const std::size_t lane{4U * (l % 4U)};
+        layout.gather[16U * half + lane] = 0x80U;
+        for (std::size_t b{0U}; b < 3U; b++)
+          layout.gather[16U * half + lane + 3U - b] = (first + b < BitsPerSymbol) ? static_cast<uint8_t>(first + b) : 0x80U;
+        layout.unpackShifts[l] = static_cast<int32_t>(l * BitsPerSymbol % 8U);
+        layout.packShifts[l] = static_cast<int32_t>(32U - BitsPerSymbol - l * BitsPerSymbol % 8U);
+        for (std::size_t b{first}; b <= last; b++)
+        {
+          const std::size_t r{shared[half][b]++};
+          layout.scatter[r][16U * half + b] = static_cast<uint8_t>(lane + 3U - (b - first));
+          layout.scatters = (r + 1U > layout.scatters) ? r + 1U : layout.scatters;
+        }
+      }
+
+      return layout;
+    }
+
+    template <uint8_t BitsPerSymbol>
+    inline constexpr PackLayout pack_layout{generate_pack_layout<BitsPerSymbol>()};
+
+    template <uint8_t BitsPerSymbol>
+    using UnpackKernel = void (*)(typename GaloisField<BitsPerSymbol>::Symbol *symbols, const uint8_t *packed, std::size_t count);
+
+    template <uint8_t BitsPerSymbol>
+    using PackKernel = void (*)(uint8_t *packed, const typename GaloisField<BitsPerSymbol>::Symbol *symbols, std::size_t count);
+
+#ifdef REEDSOLOMON_X86_SIMD
+    template <uint8_t BitsPerSymbol>
+    __attribute__((target("avx2"))) inline void unpack_avx2(typename GaloisField<BitsPerSymbol>::Symbol *symbols, const uint8_t *packed, std::size_t count)
+    /* a group of 8 symbols takes BitsPerSymbol bytes, broadcast to both
+       halves and shuffled so that each 32 bit lane holds the (up to 3) bytes
+       of its symbol on top, the symbol then being shifted down into place.
+       Groups are loaded 16 bytes at a time, the ones too close to the end of
+       the packed stream are left to unpack_scalar() */
+    {
+      constexpr auto &layout{pack_layout<BitsPerSymbol>};
+      const __m256i gather{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(layout.gather.data()))};
+      const __m256i shifts{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(layout.unpackShifts.data()))};
+      const std::size_t bytes{packed_size<BitsPerSymbol>(count)};
+      std::size_t k{0U}, p{0U};
+
+      for (; (k + 8U <= count) && (p + 16U <= bytes); k += 8U, p += BitsPerSymbol)
+      {
+        const __m256i group{_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(packed + p)))};
+        const __m256i lanes{_mm256_srli_epi32(_mm256_sllv_epi32(_mm256_shuffle_epi8(group, gather), shifts), 32 - BitsPerSymbol)};
+        const __m256i words{_mm256_packus_epi32(lanes, lanes)};
+        if constexpr (BitsPerSymbol <= 8U)
+        {
+          const __m256i narrowed{_mm256_packus_epi16(words, words)};
+          _mm_storel_epi64(reinterpret_cast<__m128i *>(symbols + k), _mm_unpacklo_epi32(_mm256_castsi256_si128(narrowed), _mm256_extracti128_si256(narrowed, 1)));
+        }
+        else
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(symbols + k), _mm256_castsi256_si128(_mm256_permute4x64_epi64(words, 0x08)));
+      }
+      unpack_scalar<BitsPerSymbol>(symbols + k, packed + p, count - k);
+    }
+
+    template <uint8_t BitsPerSymbol>
+    __attribute__((target("avx2"))) inline void pack_avx2(uint8_t *packed, const typename GaloisField<BitsPerSymbol>::Symbol *symbols, std::size_t count)
+    /* the reverse of unpack_avx2(): the symbol of each lane is shifted under
+       the bits of the previous ones and the packed bytes are gathered from
+       the lanes sharing them, one shuffle per lane, the halves being ORed.
+       Each group is stored 16 bytes at a time, the next group overwriting
+       what lies past its own BitsPerSymbol bytes */
+    {
+      constexpr auto &layout{pack_layout<BitsPerSymbol>};
+      const __m256i mask{_mm256_set1_epi32(GaloisField<BitsPerSymbol>::size)};
+      const __m256i shifts{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(layout.packShifts.data()))};
+      __m256i scatter[4];
+      const std::size_t bytes{packed_size<BitsPerSymbol>(count)};
+      std::size_t k{0U}, p{0U};
+
+      for (std::size_t r{0U}; r < layout.scatters; r++)
+        scatter[r] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(layout.scatter[r].data()));
+      for (; (k + 8U <= count) && (p + 16U <= bytes); k += 8U, p += BitsPerSymbol)
+      {
+        __m256i lanes;
+        if constexpr (BitsPerSymbol <= 8U)
+          lanes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(symbols + k)));
+        else
+          lanes = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(symbols + k)));
+        lanes = _mm256_sllv_epi32(_mm256_and_si256(lanes, mask), shifts);
+        __m256i group{_mm256_shuffle_epi8(lanes, scatter[0])};
+        for (std::size_t r{1U}; r < layout.scatters; r++)
+          group = _mm256_or_si256(group, _mm256_shuffle_epi8(lanes, scatter[r]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(packed + p), _mm_or_si128(_mm256_castsi256_si128(group), _mm256_extracti128_si256(group, 1)));
+      }
+      pack_scalar<BitsPerSymbol>(packed + p, symbols + k, count - k);
+    }
+#endif
+
+    /// @brief Pick the unpacking routine for the CPU
+    template <uint8_t BitsPerSymbol>
+    inline UnpackKernel<BitsPerSymbol> select_unpack_kernel()
+    {
+#ifdef REEDSOLOMON_X86_SIMD
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2"))
+        return unpack_avx2<BitsPerSymbol>;
+#endif
+      return unpack_scalar<BitsPerSymbol>;
+    }
+
+    /// @brief Unpacking routine picked on first use
+    template <uint8_t BitsPerSymbol>
+    inline UnpackKernel<BitsPerSymbol> unpack_kernel()
+    {
+      static const UnpackKernel<BitsPerSymbol> kernel{select_unpack_kernel<BitsPerSymbol>()};
+      return kernel;
+    }
+
+    /// @brief Pick the packing routine for the CPU
+    template <uint8_t BitsPerSymbol>
+    inline PackKernel<BitsPerSymbol> select_pack_kernel()
+    {
+#ifdef REEDSOLOMON_X86_SIMD
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2"))
+        return pack_avx2<BitsPerSymbol>;
+#endif
+      return pack_scalar<BitsPerSymbol>;
+    }
+
+    /// @brief Packing routine picked on first use
+    template <uint8_t BitsPerSymbol>
+    inline PackKernel<BitsPerSymbol> pack_kernel()
+    {
+      static const PackKernel<BitsPerSymbol> kernel{select_pack_kernel<BitsPerSymbol>()};
+      return kernel;
+    }
+
+    /// @brief Unpack count symbols, bytes being copied as they are for 8 bit symbols
+    template <uint8_t BitsPerSymbol>
+    inline void unpack_symbols(typename GaloisField<BitsPerSymbol>::Symbol *symbols, const uint8_t *packed, std::size_t count)
+    {
+      if constexpr (BitsPerSymbol == 8U)
+        memcpy(symbols, packed, count);
+      else
+        unpack_kernel<BitsPerSymbol>()(symbols, packed, count);
+    }
+
+    /// @brief Pack count symbols, bytes being copied as they are for 8 bit symbols
+    template <uint8_t BitsPerSymbol>
+    inline void pack_symbols(uint8_t *packed, const typename GaloisField<BitsPerSymbol>::Symbol *symbols, std::size_t count)
+    {
+      if constexpr (BitsPerSymbol == 8U)
+        memcpy(packed, symbols, count);
+      else
+        pack_kernel<BitsPerSymbol>()(packed, symbols, count);
+    }
+  } // namespace detail
+
+  /// @brief Galois Field arithmetic used by the syndrome computation, and the encoder for Simd and CarryLess
+  enum class Arithmetic : uint8_t
+  {
+    /// Multiplication through index form: index_of[] lookups, an index sum and an alpha_to[] lookup
+    LogAntilog,
+    /// Multiplication by a single lookup in a full product table (BitsPerSymbol <= 8, 64 KB for GF(2**8))
+    MultiplicationTable,
+    /// Parity as a matrix product and syndromes by Horner's rule, vectorized with GFNI affine transformations or
+    /// SSSE3/AVX2/AVX-512BW low/high nibble shuffles as picked at run time (BitsPerSymbol <= 8)
+    Simd,
+    /// Table free syndromes by carry-less multiply (VPCLMULQDQ or PCLMULQDQ as picked at run time) and
+    /// Barrett reduction by the field polynomial, tables when neither is available (9 <= BitsPerSymbol <= 16).
+    /// The parity is taken as dot products with the systematic parity matrix, built on first encode into static
+    /// storage of about 2*AmountOfCorrectableSymbols x 2**BitsPerSymbol symbols of 16 bits (2 MB for RS(65535,65519),
+    /// 33 MB for GF(2**16) with 127 correctable symbols). Without PCLMULQDQ the log/antilog LFSR encodes instead,
+    /// the matrix then being built only to jump over runs of zero message symbols
+    CarryLess,
+    /// Syndromes in GF((2**8)**2) isomorphic to GF(2**16), by AVX2 GF(2**8) nibble shuffles and the small
+    /// GF(2**8) tables, the GF(2**16) tables when AVX2 is not available (BitsPerSymbol == 16)
+    Composite
+  };
+
   /// @brief Reed-Solomon FEC class
   /// @tparam BitsPerSymbol Number of bits per symbol
   /// @tparam AmountOfCorrectableSymbols Amount of correctable symbols in the codeword
-  template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+  /// @tparam Backend Galois Field arithmetic backend
+  template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, Arithmetic Backend = Arithmetic::LogAntilog>
   class ReedSolomon
   {
   public:
+    static_assert(BitsPerSymbol >= 2U, "A symbol should consist of at least 2 bits of data");
+    static_assert(BitsPerSymbol <= 16U, "A symbol should consist of at most 16 bits of data");
+    static_assert((Backend != Arithmetic::MultiplicationTable) || (BitsPerSymbol <= 8U), "Multiplication table backend is limited to symbols of at most 8 bits");
+    static_assert((Backend != Arithmetic::Simd) || (BitsPerSymbol <= 8U), "SIMD backend is limited to symbols of at most 8 bits");
+    static_assert((Backend != Arithmetic::CarryLess) || (BitsPerSymbol > 8U), "Carry-less backend is meant for symbols of more than 8 bits");
+    static_assert((Backend != Arithmetic::Composite) || (BitsPerSymbol == 16U), "Composite field backend is limited to symbols of 16 bits");
+
     /// @brief Codeword that is sent through communication channel
-    static constexpr uint8_t codewordSize{(1U << BitsPerSymbol) - 1U};
+    static constexpr uint16_t codewordSize{(1U << BitsPerSymbol) - 1U};
+
+    /// @brief Size of the codeword's FEC part
+    static constexpr uint16_t fecSize{2U * AmountOfCorrectableSymbols};
+
+    static_assert((codewordSize - fecSize) >= AmountOfCorrectableSymbols, "Can't fit FEC data allowing to correct requested amount of errorneous symbols");
+
+    /// @brief Size of the data part
+    static constexpr uint16_t dataSize{codewordSize - fecSize};
+
+    /// @brief Symbol type, a byte for symbols of at most 8 bits
+    using Symbol = typename detail::GaloisField<BitsPerSymbol>::Symbol;
+
+    using Codeword = std::array<Symbol, codewordSize>;
+
+    using Message = std::array<Symbol, dataSize>;
+
+    /// @brief Size in bytes of a codeword packed BitsPerSymbol bits per symbol, MSB first
+    static constexpr std::size_t packedCodewordSize{detail::packed_size<BitsPerSymbol>(codewordSize)};
+
+    /// @brief Size in bytes of a message packed BitsPerSymbol bits per symbol, MSB first
+    static constexpr std::size_t packedMessageSize{detail::packed_size<BitsPerSymbol>(dataSize)};
+
+    /// @brief Get number of bits per symbol
+    /// @return uint8_t Number of bits per symbol
+    uint8_t getSymbolSize() const { return BitsPerSymbol; }
+
+    /// @brief Get codeword size in symbols
+    /// @return uint16_t Codeword size in symbols
+    uint16_t getCodewordSize() const { return codewordSize; }
+
+    /// @brief Get message size in symbols
+    /// @return Message size in symbols
+    uint16_t getMessageSize() const { return dataSize; }
+
+    /// @brief Get FEC size in symbols
+    /// @return FEC size in symbols
+    uint16_t getFecSize() const { return fecSize; }
+
+    /// @brief Generate codeword based on message provided
+    /// @param message The message
+    /// @return Codeword
+    Codeword generateCodeword(const Message &message)
+    {
+      Codeword codeword{};
+
+      generateCodeword(message.data(), codeword.data());
+
+      return codeword;
+    }
+
+    /// @brief Generate codeword straight into a caller owned buffer (a byte buffer for symbols of at most 8 bits)
+    /// @param message The message, getMessageSize() symbols
+    /// @param codeword Buffer for the getCodewordSize() codeword symbols, either starting with the message already or not
+    ///        overlapping it
+    void generateCodeword(const Symbol *message, Symbol *codeword)
+    {
+      // Message is part of the Codeword
+      if (message != codeword)
+      {
+        memcpy(codeword, message, dataSize * sizeof(Symbol));
+      }
+
+      // calculate FEC straight into the Codeword
+      encode_rs(message, codeword + dataSize);
+    }
+
+    /// @brief Generate codeword of a bit-packed message, see packCodeword()
+    /// @param message The packed message, packedMessageSize bytes
+    /// @param codeword Buffer for the packedCodewordSize bytes of the packed codeword, either starting with the message
+    ///        already or not overlapping it
+    void generatePackedCodeword(const uint8_t *message, uint8_t *codeword)
+    {
+      Codeword symbols;
+
+      detail::unpack_symbols<BitsPerSymbol>(symbols.data(), message, dataSize);
+      encode_rs(symbols.data(), symbols.data() + dataSize);
+      detail::pack_symbols<BitsPerSymbol>(codeword, symbols.data(), codewordSize);
+    }
+
+    /// @brief Generate the FEC of a message straight into a caller owned buffer
+    /// @param message The message, getMessageSize() symbols
+    /// @param fec Buffer for the getFecSize() FEC symbols (e.g. the tail of a packet following the message), not overlapping the message
+    void generateFec(const Symbol *message, Symbol *fec)
+    {
+      encode_rs(message, fec);
+    }
+
+#ifdef REEDSOLOMON_SPAN
+    /// @brief Generate the FEC of a message straight into a caller owned buffer
+    /// @param message The message
+    /// @param fec Buffer for the FEC symbols, not overlapping the message
+    void generateFec(std::span<const Symbol, dataSize> message, std::span<Symbol, fecSize> fec)
+    {
+      encode_rs(message.data(), fec.data());
+    }
+#endif
+
+    /// @brief Update the FEC of a message after some of its symbols changed
+    /// @param fec The getFecSize() FEC symbols of the message before the change, updated in place
+    /// @param positions Positions of the changed symbols in the message
+    /// @param oldSymbols Symbols before the change
+    /// @param newSymbols Symbols after the change
+    /// @param count Number of changed symbols
+    /// @return bool True when a position is past the message (no FEC is changed), False otherwise
+    /// @note The FEC is linear in the message, so each change adds (oldSymbol + newSymbol) times the row of its
+    ///       position in the systematic parity matrix, costing count x getFecSize() multiplications
+    bool updateFec(Symbol *fec, const uint16_t *positions, const Symbol *oldSymbols, const Symbol *newSymbols, std::size_t count)
+    {
+      static constexpr bool NO_ERROR{false};
+      static constexpr bool AN_ERROR{true};
+
+      for (std::size_t k{0U}; k < count; k++)
+      {
+        if (positions[k] >= dataSize)
+        {
+          return AN_ERROR;
+        }
+      }
+
+      if constexpr (useParityRows)
+      {
+        constexpr auto &rows{detail::parity_rows<BitsPerSymbol, AmountOfCorrectableSymbols>};
+        for (std::size_t k{0U}; k < count; k++)
+        {
+          const Symbol delta{static_cast<Symbol>(oldSymbols[k] ^ newSymbols[k])};
+          detail::mac_rows_kernel()(fec, rows[positions[k]].data(), fecSize, &delta, detail::constant_multipliers<BitsPerSymbol>, 1U, fecSize);
+        }
+      }
+      else
+      {
+        const auto &parity{detail::parity_columns<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+        for (std::size_t k{0U}; k < count; k++)
+        {
+          const Index delta{index_of[static_cast<Symbol>(oldSymbols[k] ^ newSymbols[k])]};
+          for (auto j{0U}; j < fecSize; j++)
+          {
+            fec[j] ^= alpha_to[delta + index_of[parity.columns[j][positions[k] ^ 1U]]];
+          }
+        }
+      }
+
+      return NO_ERROR;
+    }
+
+    /// @brief Update the FEC of a message after one of its symbols changed
+    /// @param fec The getFecSize() FEC symbols of the message before the change, updated in place
+    /// @param position Position of the changed symbol in the message
+    /// @param oldSymbol Symbol before the change
+    /// @param newSymbol Symbol after the change
+    /// @return bool True when the position is past the message (no FEC is changed), False otherwise
+    bool updateFec(Symbol *fec, uint16_t position, Symbol oldSymbol, Symbol newSymbol)
+    {
+      return updateFec(fec, &position, &oldSymbol, &newSymbol, 1U);
+    }
+
+    /// @brief Encoder taking the message a symbol (or a chunk) at a time in codeword order, so that each symbol can be
+    ///        sent as soon as it is produced and the FEC follows on finish()
+    /// @note Every message symbol is added times its row of the systematic parity matrix, the LFSR needing the last
+    ///       symbol first. For symbols of at most 8 bits the rows are built at compile time and chunks are taken by the
+    ///       SIMD multiply-accumulate kernel, for larger ones the row is stepped along with the message.
+    class Encoder
+    {
+    public:
+      /// @brief Constructor, ready for the first message symbol
+      Encoder()
+      {
+        reset();
+      }
+
+      /// @brief Drop the message taken so far
+      void reset()
+      {
+        position = 0U;
+        for (auto j{0U}; j < fecSize; j++)
+        {
+          parity[j] = 0U;
+          if constexpr (!useParityRows)
+          {
+            row[j] = alpha_to[gg[j]];
+          }
+        }
+      }
+
+      /// @brief Take the next message symbol
+      /// @param symbol Message symbol
+      /// @return bool True when the message is already complete (the symbol is not taken), False otherwise
+      bool push(Symbol symbol)
+      {
+        return push(&symbol, 1U);
+      }
+
+      /// @brief Take the next message symbols
+      /// @param symbols Message symbols
+      /// @param count Number of symbols
+      /// @return bool True when the symbols do not fit in the message (none is taken), False otherwise
+      bool push(const Symbol *symbols, std::size_t count)
+      {
+        static constexpr bool NO_ERROR{false};
+        static constexpr bool AN_ERROR{true};
+
+        if (count > static_cast<std::size_t>(dataSize - position))
+        {
+          return AN_ERROR;
+        }
+
+        if constexpr (useParityRows)
+        {
+          constexpr auto &rows{detail::parity_rows<BitsPerSymbol, AmountOfCorrectableSymbols>};
+          detail::mac_rows_kernel()(parity, rows[position].data(), fecSize, symbols, detail::constant_multipliers<BitsPerSymbol>, count, fecSize);
+        }
+        else
+        {
+          for (std::size_t k{0U}; k < count; k++)
+          {
+            /* parity += symbol * row, then row = row * X mod g(X) */
+            const Index symbol{index_of[symbols[k]]};
+            const Index feedback{index_of[row[fecSize - 1U]]};
+            for (auto j{fecSize - 1U}; j > 0U; j--)
+            {
+              parity[j] ^= alpha_to[symbol + index_of[row[j]]];
+              row[j] = row[j - 1U] ^ alpha_to[gg[j] + feedback];
+            }
+            parity[0] ^= alpha_to[symbol + index_of[row[0]]];
+            row[0] = alpha_to[gg[0] + feedback];
+          }
+        }
+        position = static_cast<uint16_t>(position + count);
 
-    /// @brief Size of the codeword's FEC part
-    static constexpr uint8_t fecSize{2U * AmountOfCorrectableSymbols};
+        return NO_ERROR;
+      }
 
-    static_assert(BitsPerSymbol >= 2U, "A symbol should consist of at least 2 bits of data");
-    static_assert(BitsPerSymbol <= 16U, "A symbol should consist of at most 16 bits of data");
-    static_assert((codewordSize - fecSize) >= AmountOfCorrectableSymbols, "Can't fit FEC data allowing to correct requested amount of errorneous symbols");
+      /// @brief Get the FEC of the message and get ready for the next one
+      /// @param fec Buffer for the getFecSize() FEC symbols
+      /// @note Message symbols not taken count as zeros
+      void finish(Symbol *fec)
+      {
+        for (auto j{0U}; j < fecSize; j++)
+        {
+          fec[j] = parity[j];
+        }
+        reset();
+      }
 
-    /// @brief Size of the data part
-    static constexpr uint8_t dataSize{codewordSize - fecSize};
+    private:
+      Symbol parity[fecSize];
+      Symbol row[fecSize]; /* X**(2*tt+position) mod g(X) in polynomial form, unless useParityRows */
+      uint16_t position;
+    };
 
-    using Codeword = std::array<uint16_t, codewordSize>;
+    /// @brief Recover from codeword's data errors
+    /// @param codeword Codeword
+    /// @return bool True when codeword's errors are not recoverable (no data is changed), False otherwise (codeword gets updated)
+    bool recoverCodeword(Codeword &codeword)
+    {
+      return recoverCodeword(codeword.data());
+    }
 
-    using Message = std::array<uint16_t, dataSize>;
+    /// @brief Recover from data errors of a codeword in a caller owned buffer (a byte buffer for symbols of at most 8 bits)
+    /// @param codeword The getCodewordSize() codeword symbols
+    /// @return bool True when codeword's errors are not recoverable (no data is changed), False otherwise (codeword gets updated)
+    bool recoverCodeword(Symbol *codeword)
+    {
+      static constexpr bool NO_ERROR{false};
 
-    /// @brief Get number of bits per symbol
-    /// @return uint8_t Number of bits per symbol
-    uint8_t getSymbolSize() const { return BitsPerSymbol; }
+      Index s[fecSize + 1];
 
-    /// @brief Get codeword size in symbols
-    /// @return uint8_t Codeword size in symbols
-    uint8_t getCodewordSize() const { return codewordSize; }
+      // codeword received clean is left untouched, the syndromes being evaluated in polynomial form
+      if (!syndromes_rs(codeword, s))
+      {
+        return NO_ERROR;
+      }
 
-    /// @brief Get message size in symbols
-    /// @return Message size in symbols
-    uint8_t getMessageSize() const { return dataSize; }
+      // fix transmission channel errors (out of line)
+      return decode_rs(codeword, s);
+    }
 
-    /// @brief Get FEC size in symbols
-    /// @return FEC size in symbols
-    uint8_t getFecSize() const { return fecSize; }
+    /// @brief Check a codeword without touching it
+    /// @param codeword Codeword
+    /// @return bool True when codeword holds no errors, False otherwise
+    bool isValid(const Codeword &codeword) const
+    {
+      return isValid(codeword.data());
+    }
 
-    /// @brief Generate codeword based on message provided
-    /// @param message The message
-    /// @return Codeword
-    Codeword generateCodeword(const Message &message)
+    /// @brief Check a codeword in a caller owned buffer without touching it (a byte buffer for symbols of at most 8 bits)
+    /// @param codeword The getCodewordSize() codeword symbols
+    /// @return bool True when codeword holds no errors, False otherwise
+    bool isValid(const Symbol *codeword) const
     {
-      Codeword codeword{};
+      if constexpr (useEncoderCheck)
+      {
+        Symbol fec[fecSize];
 
-      // load data
-      uint8_t index{0U};
-      for (auto element : message)
+        // re-encoded data must give the received FEC, comparison stopping at the first symbol differing
+        encode_rs(codeword, fec);
+        return (memcmp(fec, codeword + dataSize, sizeof(fec)) == 0);
+      }
+      else
       {
-        data[index] = static_cast<int>(element);     // data used by encode_rs()
-        codeword[index] = static_cast<int>(element); // Message is part of the Codeword
-        index++;
+        Index s[fecSize + 1];
+
+        return !syndromes_rs(codeword, s);
       }
+    }
+
+    /// @brief Recover from data errors of a bit-packed codeword, see packCodeword()
+    /// @param codeword The packedCodewordSize bytes of the packed codeword
+    /// @return bool True when codeword's errors are not recoverable (no data is changed), False otherwise (codeword gets updated)
+    bool recoverPackedCodeword(uint8_t *codeword)
+    {
+      static constexpr bool NO_ERROR{false};
+      static constexpr bool AN_ERROR{true};
 
-      // calculate FEC (put into bb array)
-      encode_rs();
+      Codeword symbols;
+      detail::unpack_symbols<BitsPerSymbol>(symbols.data(), codeword, codewordSize);
 
-      // extract calculated FEC
-      for (auto fecIndex{0U}; fecIndex < fecSize; fecIndex++)
+      if (recoverCodeword(symbols.data()))
       {
-        codeword[fecIndex + dataSize] = static_cast<uint16_t>(bb[fecIndex]);
+        return AN_ERROR;
       }
 
-      return codeword;
+      detail::pack_symbols<BitsPerSymbol>(codeword, symbols.data(), codewordSize);
+
+      return NO_ERROR;
     }
 
-    /// @brief Recover from codeword's data errors
+    /// @brief Pack a codeword BitsPerSymbol bits per symbol, symbol k taking bits k*BitsPerSymbol.. of the bytes MSB first
     /// @param codeword Codeword
-    /// @return bool True when codeword's errors are not recoverable (no data is changed), False otherwise (codeword gets updated)
-    bool recoverCodeword(Codeword &codeword)
+    /// @param packed Buffer for the packedCodewordSize bytes, the bits padding the last one cleared
+    /// @note With AVX2 groups of 8 symbols are moved at once by byte shuffles and per lane shifts
+    void packCodeword(const Codeword &codeword, uint8_t *packed) const
     {
-      static constexpr bool NO_ERROR{false};
-      static constexpr bool AN_ERROR{true};
+      detail::pack_symbols<BitsPerSymbol>(packed, codeword.data(), codewordSize);
+    }
 
-      // load the data
+    /// @brief Unpack a codeword, see packCodeword()
+    /// @param packed The packedCodewordSize bytes of the packed codeword
+    /// @param codeword Codeword
+    void unpackCodeword(const uint8_t *packed, Codeword &codeword) const
+    {
+      detail::unpack_symbols<BitsPerSymbol>(codeword.data(), packed, codewordSize);
+    }
+
+    /// @brief Pack a message, see packCodeword()
+    /// @param message The message
+    /// @param packed Buffer for the packedMessageSize bytes, the bits padding the last one cleared
+    void packMessage(const Message &message, uint8_t *packed) const
+    {
+      detail::pack_symbols<BitsPerSymbol>(packed, message.data(), dataSize);
+    }
+
+    /// @brief Unpack a message, see packCodeword()
+    /// @param packed The packedMessageSize bytes of the packed message
+    /// @param message The message
+    void unpackMessage(const uint8_t *packed, Message &message) const
+    {
+      detail::unpack_symbols<BitsPerSymbol>(message.data(), packed, dataSize);
+    }
+
+    /// @brief Generate codewords based on messages provided
+    /// @param messages The messages
+    /// @param codewords Codewords, codewords[k] generated from messages[k]
+    /// @param count Number of messages
+    /// @note With symbols of at most 8 bits and AVX2 the messages are encoded 32 or 64 at once, a codeword per byte
+    ///       of the vector registers (structure of arrays), else with symbols of at most 6 bits 64 messages are
+    ///       encoded at once, bitsliced in machine words
+    void generateCodewords(const Message *messages, Codeword *codewords, std::size_t count)
+    {
+      if constexpr (useSoaLanes)
       {
-        uint8_t index{0U};
-        for (auto element : codeword)
+        if (const auto kernel{detail::soa_encode_kernel<BitsPerSymbol, AmountOfCorrectableSymbols>()})
         {
-          recd[index++] = static_cast<int>(element);
+          kernel(messages, codewords, count);
+          return;
         }
-
-        // turn  received codeword into polynomial form
-        for (auto index{0U}; index < codeword.size(); index++)
+      }
+      if constexpr (useBitslicing)
+      {
+        detail::bitsliced_encode<BitsPerSymbol, AmountOfCorrectableSymbols, uint64_t>(messages, codewords, count);
+      }
+      else
+      {
+        for (std::size_t index{0U}; index < count; index++)
         {
-          recd[index] = index_of[recd[index]];
+          codewords[index] = generateCodeword(messages[index]);
         }
       }
+    }
 
-      // fix transmission channel errors
-      const auto decodeError{decode_rs()};
-
-      if (decodeError)
+    /// @brief Recover from data errors of codewords
+    /// @param codewords Codewords
+    /// @param errors errors[k] True when codewords[k] errors are not recoverable (no data is changed), False otherwise (codewords[k] gets updated)
+    /// @param count Number of codewords
+    /// @note With symbols of at most 6 bits the syndromes of up to 512 codewords are checked at once, bitsliced,
+    ///       and only the codewords found with errors are decoded one by one
+    void recoverCodewords(Codeword *codewords, bool *errors, std::size_t count)
+    {
+      if constexpr (useBitslicing)
       {
-        return AN_ERROR;
+        static constexpr std::size_t batchSize{512U};
+        uint64_t dirty[batchSize / 64U];
+        for (std::size_t first{0U}; first < count; first += batchSize)
+        {
+          const std::size_t batch{(count - first < batchSize) ? count - first : batchSize};
+          for (auto &word : dirty)
+          {
+            word = 0U;
+          }
+          detail::bitsliced_check_kernel<BitsPerSymbol, AmountOfCorrectableSymbols>()(codewords + first, dirty, batch);
+          for (std::size_t index{0U}; index < batch; index++)
+          {
+            const bool syndromeError{((dirty[index / 64U] >> (index % 64U)) & 1U) != 0U};
+            errors[first + index] = syndromeError && recoverCodeword(codewords[first + index]);
+          }
+        }
       }
-
-      // update codeword
+      else
       {
-        auto index{0U};
-        for (auto &element : codeword)
+        for (std::size_t index{0U}; index < count; index++)
         {
-          element = static_cast<uint16_t>(recd[index++]);
+          errors[index] = recoverCodeword(codewords[index]);
         }
       }
-
-      return NO_ERROR;
     }
 
     /// @brief Constructor
-    ReedSolomon();
+    /// @note Galois Field tables and the generator polynomial are built at compile time, hence construction is free
+    ReedSolomon() = default;
 
     /// Deleted copy constructor
     ReedSolomon(const ReedSolomon &) = delete;
@@ -198,477 +2933,483 @@ namespace reedsolomon
   private:
     // Variables/functions naming left as in original code
 
-    void generate_gf();
+    using GaloisField = detail::GaloisField<BitsPerSymbol>;
+    using Index = typename GaloisField::Index;
 
-    void gen_poly();
+    static void encode_rs(const Symbol *data, Symbol *bb);
 
-    void encode_rs();
+    static bool syndromes_rs(const Symbol *recd, Index (&s)[fecSize + 1]);
 
-    bool decode_rs();
+    REEDSOLOMON_NOINLINE static bool decode_rs(Symbol *recd, Index (&s)[fecSize + 1]);
 
-    int alpha_to[codewordSize + 1U];
-    int index_of[codewordSize + 1U];
-    int gg[fecSize + 1U];
-    int recd[codewordSize];
-    int data[dataSize];
-    int bb[fecSize];
-    int pp[BitsPerSymbol + 1];
-  };
+    static constexpr Index A0{GaloisField::A0};
 
-  template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
-  ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>::ReedSolomon()
-  {
-    // 1. Initialize polynomial coefficients depending on template non-type parameter BitsPerSymbol
-    uint8_t index{0U};
+    // Tables shared by every instance (built at compile time)
+    static constexpr const auto &alpha_to{detail::galois_field<BitsPerSymbol>.alpha_to};
+    static constexpr const auto &index_of{detail::galois_field<BitsPerSymbol>.index_of};
+    static constexpr auto gg{detail::gen_poly<BitsPerSymbol, AmountOfCorrectableSymbols>()};
 
-    if constexpr (BitsPerSymbol == 2U)
-    {
-      /* 1 + x + x^2 */
-      for (auto newValue : {1, 1, 1})
-      {
-        pp[index++] = newValue;
-      }
-    }
-    else if constexpr (BitsPerSymbol == 3)
-    {
-      /* 1 + x + x^3 */
-      for (auto newValue : {1, 1, 0, 1})
-      {
-        pp[index++] = newValue;
-      }
-    }
-    else if constexpr (BitsPerSymbol == 4)
+    // Encoder taps hold (2**BitsPerSymbol) x fecSize symbols, hence are used for small fields only
+    static constexpr bool useEncoderTaps{BitsPerSymbol <= 8U};
+
+    // Encoder taps are sliced to consume 2 data symbols per step (4 measured slower as the rows take twice the loads),
+    // a message of a single symbol taking one at a time
+    static constexpr std::size_t encoderSlices{(dataSize >= 2U) ? 2U : 1U};
+
+    // The log/antilog LFSR is unrolled over the taps for small t, its register then fitting in machine registers
+    static constexpr bool useUnrolledEncoder{AmountOfCorrectableSymbols <= 8U};
+
+    /// @brief One LFSR step of encode_rs(), the taps unrolled so that the register stays in machine registers and
+    ///        each gg[j] is a constant offset into alpha_to[]
+    template <std::size_t... Taps>
+    static void encode_step(Symbol (&reg)[fecSize], Index feedback, std::index_sequence<Taps...>)
     {
-      /* 1 + x + x^4 */
-      for (auto newValue : {1, 1, 0, 0, 1})
-      {
-        pp[index++] = newValue;
-      }
+      ((reg[fecSize - 1U - Taps] = static_cast<Symbol>(((Taps + 1U < fecSize) ? reg[fecSize - 2U - Taps] : Symbol{0U}) ^ alpha_to[gg[fecSize - 1U - Taps] + feedback])), ...);
     }
-    else if constexpr (BitsPerSymbol == 5)
+
+    // Runs of zero data symbols this long are jumped by the encoder at once, multiplying its register by X**run mod g(X)
+    // through the parity matrix rows (fecSize**2 products against run*fecSize for shifting the run through)
+    static constexpr int zeroRunLength{fecSize + 8};
+
+    // The parity matrix is built at run time into static storage (2*fecSize x codewordSize symbols of 16 bits), which
+    // only the carry-less encoder needs anyway above GF(2**8), hence zero runs of other backends are capped by its size
+    static constexpr std::size_t zeroRunMatrixBudget{64U * 1024U};
+
+    // Messages too short to hold a few such runs are shifted through symbol by symbol, skipping the checks
+    static constexpr bool useZeroRuns{(dataSize >= 4 * zeroRunLength) && ((BitsPerSymbol <= 8U) || (Backend == Arithmetic::CarryLess) || (sizeof(detail::ParityColumns<BitsPerSymbol, AmountOfCorrectableSymbols>) <= zeroRunMatrixBudget))};
+
+    /// @brief Length of the run of zero symbols data[i], data[i-1].. when at least zeroRunLength, 0 otherwise, the
+    ///        shorter runs being measured once as next is moved below them
+    static int zero_run(const Symbol *data, int i, int &next)
     {
-      /* 1 + x^2 + x^5 */
-      for (auto newValue : {1, 0, 1, 0, 0, 1})
-      {
-        pp[index++] = newValue;
-      }
+      int k{i};
+
+      if (i > next)
+        return 0;
+      while ((k >= 0) && (data[k] == 0U))
+        k--;
+      if (i - k >= zeroRunLength)
+        return i - k;
+      next = k;
+      return 0;
     }
-    else if constexpr (BitsPerSymbol == 6)
+
+    /// @brief Multiply the encoder register by X**run mod g(X), for run >= fecSize, as the sum of its symbols j times
+    ///        the parity rows run-fecSize+j, which hold X**(run+j) mod g(X)
+    static void encode_jump(Symbol *reg, int run)
     {
-      /* 1 + x + x^6 */
-      for (auto newValue : {1, 1, 0, 0, 0, 0, 1})
+      const auto &parity{detail::parity_columns<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+      Symbol jumped[fecSize] = {};
+
+      for (int j{0}; j < fecSize; j++)
       {
-        pp[index++] = newValue;
+        if (reg[j] != 0U)
+        {
+          const Index x{index_of[reg[j]]};
+          const int k{(run - fecSize + j) ^ 1};
+          for (int m{0}; m < fecSize; m++)
+            jumped[m] ^= alpha_to[x + index_of[parity.columns[m][k]]];
+        }
       }
+      for (int j{0}; j < fecSize; j++)
+        reg[j] = jumped[j];
     }
-    else if constexpr (BitsPerSymbol == 7)
-    {
-      /* 1 + x^3 + x^7 */
-      for (auto newValue : {1, 0, 0, 1, 0, 0, 0, 1})
+
+    // isValid() re-encodes the data where the encoder outruns the syndromes (taps of small fields, carry-less parity
+    // columns), the syndromes being evaluated otherwise (SIMD, composite and larger log/antilog fields)
+    static constexpr bool useEncoderCheck{(Backend == Arithmetic::CarryLess) || ((BitsPerSymbol <= 8U) && (Backend != Arithmetic::Simd))};
+
+    // Structure of arrays lanes hold a symbol per byte
+    static constexpr bool useSoaLanes{BitsPerSymbol <= 8U};
+
+    // Parity matrix rows are (2**BitsPerSymbol) x fecSize symbols, hence are built at compile time for small fields only
+    static constexpr bool useParityRows{BitsPerSymbol <= 8U};
+
+    // Bitsliced multiplications take up to BitsPerSymbol**2 XORs of machine words, hence batches are bitsliced for small symbols only
+    static constexpr bool useBitslicing{BitsPerSymbol <= 6U};
+  };
+
+  template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, Arithmetic Backend>
+  void ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols, Backend>::encode_rs(const Symbol *data, Symbol *bb)
+  /* take the string of symbols in data[i], i=0..(k-1) and encode systematically
+     to produce 2*tt parity symbols in bb[0]..bb[2*tt-1]
+     data[] is input and bb[] is output in polynomial form, both owned by the
+     caller and holding a byte per symbol for small fields.
+     Encoding is done by using a feedback shift register with appropriate
+     connections specified by the elements of gg[], which was generated above.
+     Codeword is   c(X) = data(X)*X**(nn-kk)+ b(X)
+     A zero feedback (A0) or a zero connection addresses the zero padded part
+     of alpha_to[] so no branches are needed.
+     For small fields the feedback stays in polynomial form and selects a row
+     of encoder taps holding its products with every gg[j]. As the register
+     is linear, encoderSlices steps at once amount to shifting it by as many
+     symbols and adding a row of each slice, selected by the data symbol of
+     its step plus the register symbol that feeds back at that step. This
+     breaks the serial feedback chain, and the register is held in 64 bit
+     words so that shifts and additions take 8 symbols at a time.
+     For small tt the register of larger fields is kept in machine registers,
+     the shift being unrolled over the taps.
+     With SIMD arithmetic the parity is the product of data[] and the
+     systematic parity matrix, which has no serial dependency. Carry-less
+     arithmetic takes every parity symbol as a dot product of data[] with
+     its column of the matrix.
+     The shifting encoders jump over runs of zeroRunLength zero symbols or
+     more, multiplying the register by X**run mod g(X) through the rows of
+     that matrix. */
+  {
+    int i, j;
+
+    if constexpr (Backend == Arithmetic::CarryLess)
+      if (const auto kernel{detail::carry_less_parity_kernel()})
       {
-        pp[index++] = newValue;
+        const auto &parity{detail::parity_columns<BitsPerSymbol, AmountOfCorrectableSymbols>()};
+        kernel(bb, data, dataSize, detail::carry_less_field<BitsPerSymbol>, parity.columns[0], parity.stride, fecSize);
+        return;
       }
-    }
-    else if constexpr (BitsPerSymbol == 8)
+    for (i = 0; i < fecSize; i++)
+      bb[i] = 0;
+    if constexpr (Backend == Arithmetic::Simd)
     {
-      /* 1 + x^2 + x^3 + x^4 + x^8 */
-      for (auto newValue : {1, 0, 1, 1, 1, 0, 0, 0, 1})
-      {
-        pp[index++] = newValue;
-      }
+      constexpr auto &rows{detail::parity_rows<BitsPerSymbol, AmountOfCorrectableSymbols>};
+      detail::mac_rows_kernel()(bb, rows[0].data(), fecSize, data, detail::constant_multipliers<BitsPerSymbol>, dataSize, fecSize);
     }
-    else if constexpr (BitsPerSymbol == 9)
+    else if constexpr (useEncoderTaps)
     {
-      /* 1 + x^4 + x^9 */
-      for (auto newValue : {1, 0, 0, 0, 1, 0, 0, 0, 0, 1})
+      constexpr auto &slices{detail::encoder_slices<BitsPerSymbol, AmountOfCorrectableSymbols, encoderSlices>};
+      constexpr auto words{std::make_index_sequence<detail::encoder_words<AmountOfCorrectableSymbols>>{}};
+      uint64_t reg[detail::encoder_words<AmountOfCorrectableSymbols>] = {}; /* bb[], symbols above 2*tt are don't care */
+      const uint64_t *rows[encoderSlices];
+      int s, run, next = dataSize - 1;
+
+      for (i = dataSize - 1; (i + 1) % encoderSlices != 0; i--) /* leading symbols one at a time with the taps */
       {
-        pp[index++] = newValue;
+        const uint64_t *const taps[1] = {slices[encoderSlices - 1][data[i] ^ detail::encoder_symbol(reg, fecSize - 1)].data()};
+        detail::encoder_shift<1U>(reg, words);
+        detail::encoder_add(reg, taps, words);
       }
-    }
-    else if constexpr (BitsPerSymbol == 10)
-    {
-      /* 1 + x^3 + x^10 */
-      for (auto newValue : {1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1})
+      while (i >= 0)
       {
-        pp[index++] = newValue;
+        for (; i >= 0; i -= encoderSlices)
+        {
+          if constexpr (useZeroRuns)
+            if ((data[i] == 0U) && ((run = zero_run(data, i, next)) > 0))
+              break;
+          for (s = 0; s < static_cast<int>(encoderSlices); s++)
+            rows[s] = slices[s][data[i - s] ^ detail::encoder_symbol(reg, fecSize - 1 - s)].data();
+          detail::encoder_shift<encoderSlices>(reg, words);
+          detail::encoder_add(reg, rows, words);
+        }
+        if (i >= 0) /* over a run of zeros, whole steps */
+        {
+          run -= run % encoderSlices;
+          detail::encoder_jump<BitsPerSymbol, AmountOfCorrectableSymbols>(reg, static_cast<std::size_t>(run));
+          i -= run;
+        }
       }
+      for (j = 0; j < fecSize; j++)
+        bb[j] = detail::encoder_symbol(reg, j);
     }
-    else if constexpr (BitsPerSymbol == 11)
+    else if constexpr (useUnrolledEncoder)
     {
-      /* 1 + x^2 + x^11 */
-      for (auto newValue : {1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1})
+      Symbol reg[fecSize] = {}; /* bb[] */
+      int run, next = dataSize - 1;
+      for (i = dataSize - 1; i >= 0;)
       {
-        pp[index++] = newValue;
+        for (; i >= 0; i--)
+        {
+          if constexpr (useZeroRuns)
+            if ((data[i] == 0U) && ((run = zero_run(data, i, next)) > 0))
+              break;
+          encode_step(reg, index_of[data[i] ^ reg[fecSize - 1]], std::make_index_sequence<fecSize>{});
+        }
+        if (i >= 0) /* over a run of zeros */
+        {
+          encode_jump(reg, run);
+          i -= run;
+        }
       }
+      for (j = 0; j < fecSize; j++)
+        bb[j] = reg[j];
     }
-    else if constexpr (BitsPerSymbol == 12)
+    else
     {
-      /* 1 + x + x^4 + x^6 + x^12 */
-      for (auto newValue : {1, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1})
+      Index feedback;
+      int run, next = dataSize - 1;
+      for (i = dataSize - 1; i >= 0; i--)
       {
-        pp[index++] = newValue;
+        if constexpr (useZeroRuns)
+          if ((data[i] == 0U) && ((run = zero_run(data, i, next)) > 0))
+          {
+            encode_jump(bb, run);
+            i -= run - 1;
+            continue;
+          }
+        feedback = index_of[data[i] ^ bb[fecSize - 1]];
+        for (j = fecSize - 1; j > 0; j--)
+          bb[j] = bb[j - 1] ^ alpha_to[gg[j] + feedback];
+        bb[0] = alpha_to[gg[0] + feedback];
       }
     }
-    else if constexpr (BitsPerSymbol == 13)
+  };
+
+  template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, Arithmetic Backend>
+  bool ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols, Backend>::syndromes_rs(const Symbol *recd, Index (&s)[fecSize + 1])
+  /* assume we have received bits grouped into mm-bit symbols in recd[i],
+     i=0..(nn-1), in polynomial form. We compute the 2*tt syndromes by
+     substituting alpha**i into rec(X) and evaluating, storing the syndromes
+     in s[i], i=1..2tt, in polynomial form (s[0] is left alone).
+     With the log/antilog tables or the multiplication table the syndromes
+     are evaluated by Horner's rule, each step multiplying the accumulator by
+     the constant alpha**i and adding recd[j]. As the steps of a syndrome are
+     serial, rec(X) is split in phases interleaving enough chains to hide
+     the lookup latency, phase p holding recd[j] for j mod phases = p and
+     being evaluated at alpha**(i*phases), then added up times alpha**(i*p).
+     With SIMD arithmetic the syndromes are evaluated by Horner's rule in 16
+     phases, a vector lane per syndrome (see detail::syndromes_ssse3()).
+     With carry-less arithmetic the syndromes are evaluated without touching
+     alpha_to[] and index_of[] (unless the CPU has no carry-less multiply).
+     With composite field arithmetic recd[] is mapped to GF((2**8)**2) and
+     the syndromes are evaluated there, then mapped back (the tables are used
+     when the CPU has no AVX2).
+     Returns true when a syndrome is non-zero, i.e. recd[] is not a codeword. */
+  {
+    int i, j, e, p, q;
+    Index syn_error = 0;
+
+    bool tables{(Backend == Arithmetic::LogAntilog) || (Backend == Arithmetic::MultiplicationTable)}; /* evaluated by Horner's rule */
+    if constexpr (Backend == Arithmetic::Simd)
     {
-      /* 1 + x + x^3 + x^4 + x^13 */
-      for (auto newValue : {1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1})
-      {
-        pp[index++] = newValue;
-      }
+      uint8_t syndromes[fecSize];
+      detail::syndromes_kernel()(syndromes, recd, codewordSize, detail::syndrome_multipliers<BitsPerSymbol, AmountOfCorrectableSymbols>.data(), fecSize);
+      for (i = 1; i <= fecSize; i++)
+        s[i] = syndromes[i - 1];
     }
-    else if constexpr (BitsPerSymbol == 14)
+    else if constexpr (Backend == Arithmetic::CarryLess)
     {
-      /* 1 + x + x^6 + x^10 + x^14 */
-      for (auto newValue : {1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1})
+      if (const auto kernel{detail::carry_less_syndromes_kernel()})
       {
-        pp[index++] = newValue;
+        uint16_t syndromes[fecSize];
+        kernel(syndromes, recd, codewordSize, detail::carry_less_field<BitsPerSymbol>, detail::carry_less_powers<BitsPerSymbol, AmountOfCorrectableSymbols>.data(), fecSize);
+        for (i = 1; i <= fecSize; i++)
+          s[i] = syndromes[i - 1];
       }
+      else /* no carry-less multiply instruction, fall back to the tables */
+        tables = true;
     }
-    else if constexpr (BitsPerSymbol == 15)
+    else if constexpr (Backend == Arithmetic::Composite)
     {
-      /* 1 + x + x^15 */
-      for (auto newValue : {1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1})
+      if (const auto kernel{detail::composite_syndromes_kernel()})
       {
-        pp[index++] = newValue;
+        uint16_t syndromes[fecSize];
+        kernel(syndromes, recd, codewordSize, detail::composite_field<BitsPerSymbol>, detail::composite_powers<AmountOfCorrectableSymbols>.data(), fecSize);
+        for (i = 1; i <= fecSize; i++)
+          s[i] = syndromes[i - 1];
       }
+      else /* no AVX2, fall back to the tables */
+        tables = true;
     }
-    else if constexpr (BitsPerSymbol == 16)
+    if (tables)
     {
-      /* 1 + x + x^3 + x^12 + x^16 */
-      for (auto newValue : {1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1})
+      constexpr int chains{(Backend == Arithmetic::MultiplicationTable) ? 8 : 16}; /* a lookup or two per step */
+      constexpr int phases{(fecSize >= chains) ? 1 : (chains - 1 + fecSize) / fecSize};
+      Index acc[phases][fecSize] = {}, step[fecSize]; /* step[i] = alpha**((i+1)*phases), in polynomial form with the multiplication table */
+      for (i = 0; i < fecSize; i++)
+        if constexpr (Backend == Arithmetic::MultiplicationTable)
+          step[i] = alpha_to[GaloisField::modnn((i + 1) * phases)];
+        else
+          step[i] = GaloisField::modnn((i + 1) * phases);
+      for (q = (codewordSize - 1) / phases; q >= 0; q--)
+        for (p = 0; p < phases; p++)
+        {
+          j = q * phases + p;
+          const Symbol r{(j < codewordSize) ? recd[j] : Symbol{0U}}; /* zero past the top of rec(X) */
+          for (i = 0; i < fecSize; i++)
+            if constexpr (Backend == Arithmetic::MultiplicationTable)
+              acc[p][i] = detail::multiplication_table<BitsPerSymbol>[step[i]][acc[p][i]] ^ r;
+            else
+              acc[p][i] = alpha_to[index_of[acc[p][i]] + step[i]] ^ r;
+        }
+      for (i = 1; i <= fecSize; i++)
       {
-        pp[index++] = newValue;
+        s[i] = acc[0][i - 1];
+        for (p = 1, e = i; p < phases; p++, e += i) /* e = i*p */
+          if constexpr (Backend == Arithmetic::MultiplicationTable)
+            s[i] ^= detail::multiplication_table<BitsPerSymbol>[alpha_to[GaloisField::modnn(e)]][acc[p][i - 1]];
+          else
+            s[i] ^= alpha_to[index_of[acc[p][i - 1]] + GaloisField::modnn(e)];
       }
     }
+    for (i = 1; i <= fecSize; i++)
+      syn_error |= s[i];
 
-    // 2. Generate Galois Field
-    generate_gf();
-
-    // 3. Obtain generator polynomial
-    gen_poly();
+    return syn_error != 0;
   }
 
-  template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
-  void ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>::generate_gf()
-  /* generate GF(2**mm) from the irreducible polynomial p(X) in pp[0]..pp[mm]
-     lookup tables:  index->polynomial form   alpha_to[] contains j=alpha**i;
-                     polynomial form -> index form  index_of[j=alpha**i] = i
-     alpha=2 is the primitive element of GF(2**mm)
-  */
+  template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, Arithmetic Backend>
+  bool ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols, Backend>::decode_rs(Symbol *recd, Index (&s)[fecSize + 1])
+  /* assume we have received bits grouped into mm-bit symbols in recd[i],
+     i=0..(nn-1), in polynomial form, and its non-zero syndromes s[i],
+     i=1..2tt, in polynomial form (see syndromes_rs()).
+     We use the Berlekamp-Massey iteration to find the error location polynomial
+     lambda[i], keeping only the current polynomial and the one held before its
+     last change of degree (at most tt+1 coefficients each), the latter shifted
+     and scaled by the ratio of discrepancies whenever a discrepancy is not zero.
+     If the degree of the elp exceeds tt, we cannot correct all the errors and
+     stop right there, as the degree never decreases along the iteration.
+     If the degree of elp is <=tt, we substitute alpha**i ,
+     i=1..n into the elp to get the roots, hence the inverse roots, the error
+     location numbers (Chien search). If the number of errors located does not
+     equal the degree of the elp, we have more than tt errors and cannot
+     correct them.  Otherwise, we then solve for the error value at the error
+     location by Forney's formula, from the error evaluator z(x), and correct
+     the error.  For the cases where the number of errors is known to be too
+     large to correct, the information symbols as received are output (the
+     advantage of systematic encoding is that hopefully some of the information
+     symbols will be okay and that if we are in luck, the errors are in the
+     parity part of the transmitted codeword), and the error is flagged to the
+     calling routine.
+     The zero element is A0 in index form, alpha_to[] yields zero for any sum of
+     indexes involving it.
+     Only the symbols in error are read and corrected in recd[]. */
   {
-    int i, mask;
+    static constexpr bool NO_ERROR{false};
+    static constexpr bool AN_ERROR{true};
 
-    mask = 1;
-    alpha_to[BitsPerSymbol] = 0;
-    for (i = 0; i < BitsPerSymbol; i++)
+    int i, j, r, m, el, q, e;
+    Index lambda[AmountOfCorrectableSymbols + 1], b[AmountOfCorrectableSymbols + 1], discr, bd, err;
+    int count = 0, root[AmountOfCorrectableSymbols] = {}, loc[AmountOfCorrectableSymbols] = {};
+    Index z[AmountOfCorrectableSymbols + 1], reg[AmountOfCorrectableSymbols + 1];
+    int step[AmountOfCorrectableSymbols + 1];
+
+    /* convert syndromes from polynomial form to index form  */
+    for (i = 1; i <= fecSize; i++)
+      s[i] = index_of[s[i]];
+
+    /* compute the error location polynomial lambda(x) via the Berlekamp-Massey
+       algorithm : el is its degree, b(x) the lambda(x) held before its last
+       change of degree (index form), bd the discrepancy (index form) that
+       brought that change and m the steps taken since, by which b(x) is shifted.
+       As the degree never decreases, steps making it exceed tt end the decoding.
+    */
+    lambda[0] = 1; /* polynomial form */
+    b[0] = 0;      /* index form */
+    for (i = 1; i <= AmountOfCorrectableSymbols; i++)
     {
-      alpha_to[i] = mask;
-      index_of[alpha_to[i]] = i;
-      if (pp[i] != 0)
-        alpha_to[BitsPerSymbol] ^= mask;
-      mask <<= 1;
+      lambda[i] = 0; /* polynomial form */
+      b[i] = A0;     /* index form */
     }
-    index_of[alpha_to[BitsPerSymbol]] = BitsPerSymbol;
-    mask >>= 1;
-    for (i = BitsPerSymbol + 1; i < codewordSize; i++)
+    bd = 0;
+    el = 0;
+    m = 1;
+
+    for (r = 1; r <= fecSize; r++)
     {
-      if (alpha_to[i - 1] >= mask)
-        alpha_to[i] = alpha_to[BitsPerSymbol] ^ ((alpha_to[i - 1] ^ mask) << 1);
+      /* form rth discrepancy */
+      discr = alpha_to[s[r]];
+      for (i = 1; i <= el; i++)
+        discr ^= alpha_to[s[r - i] + index_of[lambda[i]]];
+      discr = index_of[discr]; /* put discr into index form */
+
+      if (discr == A0)
+      {
+        m++;
+        continue;
+      }
+
+      /* lambda(x) -= discr/bd * x**m * b(x), the factor in index form */
+      e = GaloisField::modnn(discr + codewordSize - bd);
+      if (2 * el < r)
+      {
+        if (r - el > AmountOfCorrectableSymbols) /* elp has degree >tt hence cannot solve */
+          return AN_ERROR;
+
+        /* degree changes: b(x) takes the old lambda(x) in place, going down so
+           that b[i - m] is read before b[i] gets overwritten */
+        for (i = r - el; i >= m; i--)
+        {
+          const Index old{lambda[i]};
+          lambda[i] ^= alpha_to[e + b[i - m]];
+          b[i] = index_of[old];
+        }
+        for (; i >= 0; i--)
+          b[i] = index_of[lambda[i]];
+        el = r - el;
+        bd = discr;
+        m = 1;
+      }
       else
-        alpha_to[i] = alpha_to[i - 1] << 1;
-      index_of[alpha_to[i]] = i;
+      {
+        for (i = m; i <= el; i++)
+          lambda[i] ^= alpha_to[e + b[i - m]];
+        m++;
+      }
     }
-    index_of[0] = -1;
-  }
 
-  template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
-  void ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>::gen_poly()
-  /* Obtain the generator polynomial of the tt-error correcting, length
-    nn=(2**mm -1) Reed Solomon code  from the product of (X+alpha**i), i=1..2*tt
-  */
-  {
-    int i, j;
+    /* put lambda into index form */
+    for (i = 0; i <= el; i++)
+      lambda[i] = index_of[lambda[i]];
 
-    gg[0] = 2; /* primitive element alpha = 2  for GF(2**mm)  */
-    gg[1] = 1; /* g(x) = (X+alpha) initially */
-    for (i = 2; i <= fecSize; i++)
+    /* find roots of the error location polynomial */
+    for (i = 1; i <= el; i++)
     {
-      gg[i] = 1;
-      for (j = i - 1; j > 0; j--)
-        if (gg[j] != 0)
-          gg[j] = gg[j - 1] ^ alpha_to[(index_of[gg[j]] + i) % codewordSize];
-        else
-          gg[j] = gg[j - 1];
-      gg[0] = alpha_to[(index_of[gg[0]] + i) % codewordSize]; /* gg[0] can never be zero */
+      reg[i] = lambda[i];
+      step[i] = 0; /* step[j] = i*j mod nn */
     }
-    /* convert gg[] to index form for quicker encoding */
-    for (i = 0; i <= fecSize; i++)
-      gg[i] = index_of[gg[i]];
-  }
-
-  template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
-  void ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>::encode_rs()
-  /* take the string of symbols in data[i], i=0..(k-1) and encode systematically
-     to produce 2*tt parity symbols in bb[0]..bb[2*tt-1]
-     data[] is input and bb[] is output in polynomial form.
-     Encoding is done by using a feedback shift register with appropriate
-     connections specified by the elements of gg[], which was generated above.
-     Codeword is   c(X) = data(X)*X**(nn-kk)+ b(X)          */
-  {
-    int i, j;
-    int feedback;
-
-    for (i = 0; i < fecSize; i++)
-      bb[i] = 0;
-    for (i = dataSize - 1; i >= 0; i--)
+    count = 0;
+    for (i = 1; i <= codewordSize; i++)
     {
-      feedback = index_of[data[i] ^ bb[fecSize - 1]];
-      if (feedback != -1)
+      q = 1;
+      for (j = 1; j <= el; j++)
       {
-        for (j = fecSize - 1; j > 0; j--)
-          if (gg[j] != -1)
-            bb[j] = bb[j - 1] ^ alpha_to[(gg[j] + feedback) % codewordSize];
-          else
-            bb[j] = bb[j - 1];
-        bb[0] = alpha_to[(gg[0] + feedback) % codewordSize];
+        step[j] += j;
+        if (step[j] >= codewordSize)
+          step[j] -= codewordSize;
+        q ^= alpha_to[reg[j] + step[j]];
       }
-      else
+      if (!q) /* store root and error location number indices */
       {
-        for (j = fecSize - 1; j > 0; j--)
-          bb[j] = bb[j - 1];
-        bb[0] = 0;
+        root[count] = GaloisField::modnn(i);
+        loc[count] = codewordSize - i;
+        count++;
       };
     };
-  };
-
-  template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
-  bool ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>::decode_rs()
-  /* assume we have received bits grouped into mm-bit symbols in recd[i],
-     i=0..(nn-1),  and recd[i] is index form (ie as powers of alpha).
-     We first compute the 2*tt syndromes by substituting alpha**i into rec(X) and
-     evaluating, storing the syndromes in s[i], i=1..2tt (leave s[0] zero) .
-     Then we use the Berlekamp iteration to find the error location polynomial
-     elp[i].   If the degree of the elp is >tt, we cannot correct all the errors
-     and hence just put out the information symbols uncorrected. If the degree of
-     elp is <=tt, we substitute alpha**i , i=1..n into the elp to get the roots,
-     hence the inverse roots, the error location numbers. If the number of errors
-     located does not equal the degree of the elp, we have more than tt errors
-     and cannot correct them.  Otherwise, we then solve for the error value at
-     the error location and correct the error.  The procedure is that found in
-     Lin and Costello. For the cases where the number of errors is known to be too
-     large to correct, the information symbols as received are output (the
-     advantage of systematic encoding is that hopefully some of the information
-     symbols will be okay and that if we are in luck, the errors are in the
-     parity part of the transmitted codeword).  Of course, these insoluble cases
-     can be returned as error flags to the calling routine if desired.   */
-  {
-    static constexpr bool NO_ERROR{false};
-    static constexpr bool AN_ERROR{true};
-
-    int i, j, u, q;
-    int elp[fecSize + 2][fecSize], d[fecSize + 2], l[fecSize + 2], u_lu[fecSize + 2], s[fecSize + 1];
-    int count = 0, syn_error = 0, root[AmountOfCorrectableSymbols], loc[AmountOfCorrectableSymbols], z[AmountOfCorrectableSymbols + 1], err[codewordSize], reg[AmountOfCorrectableSymbols + 1];
-
-    /* first form the syndromes */
-    for (i = 1; i <= fecSize; i++)
+    if (count == el) /* no. roots = degree of elp hence <= tt errors */
     {
-      s[i] = 0;
-      for (j = 0; j < codewordSize; j++)
-        if (recd[j] != -1)
-          s[i] ^= alpha_to[(recd[j] + i * j) % codewordSize]; /* recd[j] in index form */
-                                                              /* convert syndrome from polynomial form to index form  */
-      if (s[i] != 0)
-        syn_error = 1; /* set flag if non-zero syndrome => error */
-      s[i] = index_of[s[i]];
-    };
+      /* form polynomial z(x) */
+      for (i = 1; i <= el; i++) /* Z[0] = 1 always - do not need */
+      {
+        z[i] = alpha_to[s[i]] ^ alpha_to[lambda[i]];
+        for (j = 1; j < i; j++)
+          z[i] ^= alpha_to[lambda[i - j] + s[j]];
+        z[i] = index_of[z[i]]; /* put into index form */
+      };
 
-    if (syn_error) /* if errors, try and correct */
-    {
-      /* compute the error location polynomial via the Berlekamp iterative algorithm,
-         following the terminology of Lin and Costello :   d[u] is the 'mu'th
-         discrepancy, where u='mu'+1 and 'mu' (the Greek letter!) is the step number
-         ranging from -1 to 2*tt (see L&C),  l[u] is the
-         degree of the elp at that step, and u_l[u] is the difference between the
-         step number and the degree of the elp.
-      */
-      /* initialise table entries */
-      d[0] = 0;      /* index form */
-      d[1] = s[1];   /* index form */
-      elp[0][0] = 0; /* index form */
-      elp[1][0] = 1; /* polynomial form */
-      for (i = 1; i < fecSize; i++)
-      {
-        elp[0][i] = -1; /* index form */
-        elp[1][i] = 0;  /* polynomial form */
-      }
-      l[0] = 0;
-      l[1] = 0;
-      u_lu[0] = -1;
-      u_lu[1] = 0;
-      u = 0;
-
-      do
-      {
-        u++;
-        if (d[u] == -1)
-        {
-          l[u + 1] = l[u];
-          for (i = 0; i <= l[u]; i++)
-          {
-            elp[u + 1][i] = elp[u][i];
-            elp[u][i] = index_of[elp[u][i]];
-          }
-        }
-        else
-        /* search for words with greatest u_lu[q] for which d[q]!=0 */
+      /* evaluate errors at locations given by error location numbers loc[i] */
+      for (i = 0; i < el; i++) /* compute numerator of error term first */
+      {
+        err = 1; /* accounts for z[0] */
+        for (j = 1, e = root[i]; j <= el; j++) /* e = j*root[i] mod nn */
         {
-          q = u - 1;
-          while ((d[q] == -1) && (q > 0))
-            q--;
-          /* have found first non-zero d[q]  */
-          if (q > 0)
-          {
-            j = q;
-            do
-            {
-              j--;
-              if ((d[j] != -1) && (u_lu[q] < u_lu[j]))
-                q = j;
-            } while (j > 0);
-          };
-
-          /* have now found q such that d[u]!=0 and u_lu[q] is maximum */
-          /* store degree of new elp polynomial */
-          if (l[u] > l[q] + u - q)
-            l[u + 1] = l[u];
-          else
-            l[u + 1] = l[q] + u - q;
-
-          /* form new elp(x) */
-          for (i = 0; i < fecSize; i++)
-            elp[u + 1][i] = 0;
-          for (i = 0; i <= l[q]; i++)
-            if (elp[q][i] != -1)
-              elp[u + 1][i + u - q] = alpha_to[(d[u] + codewordSize - d[q] + elp[q][i]) % codewordSize];
-          for (i = 0; i <= l[u]; i++)
-          {
-            elp[u + 1][i] ^= elp[u][i];
-            elp[u][i] = index_of[elp[u][i]]; /*convert old elp value to index*/
-          }
+          err ^= alpha_to[z[j] + e];
+          e += root[i];
+          if (e >= codewordSize)
+            e -= codewordSize;
         }
-        u_lu[u + 1] = u - l[u + 1];
-
-        /* form (u+1)th discrepancy */
-        if (u < fecSize) /* no discrepancy computed on last iteration */
+        if (err != 0)
         {
-          if (s[u + 1] != -1)
-            d[u + 1] = alpha_to[s[u + 1]];
-          else
-            d[u + 1] = 0;
-          for (i = 1; i <= l[u + 1]; i++)
-            if ((s[u + 1 - i] != -1) && (elp[u + 1][i] != 0))
-              d[u + 1] ^= alpha_to[(s[u + 1 - i] + index_of[elp[u + 1][i]]) % codewordSize];
-          d[u + 1] = index_of[d[u + 1]]; /* put d[u+1] into index form */
-        }
-      } while ((u < fecSize) && (l[u + 1] <= AmountOfCorrectableSymbols));
-
-      u++;
-      if (l[u] <= AmountOfCorrectableSymbols) /* can correct error */
-      {
-        /* put elp into index form */
-        for (i = 0; i <= l[u]; i++)
-          elp[u][i] = index_of[elp[u][i]];
-
-        /* find roots of the error location polynomial */
-        for (i = 1; i <= l[u]; i++)
-          reg[i] = elp[u][i];
-        count = 0;
-        for (i = 1; i <= codewordSize; i++)
-        {
-          q = 1;
-          for (j = 1; j <= l[u]; j++)
-            if (reg[j] != -1)
-            {
-              reg[j] = (reg[j] + j) % codewordSize;
-              q ^= alpha_to[reg[j]];
-            };
-          if (!q) /* store root and error location number indices */
-          {
-            root[count] = i;
-            loc[count] = codewordSize - i;
-            count++;
-          };
-        };
-        if (count == l[u]) /* no. roots = degree of elp hence <= tt errors */
-        {
-          /* form polynomial z(x) */
-          for (i = 1; i <= l[u]; i++) /* Z[0] = 1 always - do not need */
-          {
-            if ((s[i] != -1) && (elp[u][i] != -1))
-              z[i] = alpha_to[s[i]] ^ alpha_to[elp[u][i]];
-            else if ((s[i] != -1) && (elp[u][i] == -1))
-              z[i] = alpha_to[s[i]];
-            else if ((s[i] == -1) && (elp[u][i] != -1))
-              z[i] = alpha_to[elp[u][i]];
-            else
-              z[i] = 0;
-            for (j = 1; j < i; j++)
-              if ((s[j] != -1) && (elp[u][i - j] != -1))
-                z[i] ^= alpha_to[(elp[u][i - j] + s[j]) % codewordSize];
-            z[i] = index_of[z[i]]; /* put into index form */
-          };
-
-          /* evaluate errors at locations given by error location numbers loc[i] */
-          for (i = 0; i < codewordSize; i++)
-          {
-            err[i] = 0;
-            if (recd[i] != -1) /* convert recd[] to polynomial form */
-              recd[i] = alpha_to[recd[i]];
-            else
-              recd[i] = 0;
-          }
-          for (i = 0; i < l[u]; i++) /* compute numerator of error term first */
-          {
-            err[loc[i]] = 1; /* accounts for z[0] */
-            for (j = 1; j <= l[u]; j++)
-              if (z[j] != -1)
-                err[loc[i]] ^= alpha_to[(z[j] + j * root[i]) % codewordSize];
-            if (err[loc[i]] != 0)
-            {
-              err[loc[i]] = index_of[err[loc[i]]];
-              q = 0; /* form denominator of error term */
-              for (j = 0; j < l[u]; j++)
-                if (j != i)
-                  q += index_of[1 ^ alpha_to[(loc[j] + root[i]) % codewordSize]];
-              q = q % codewordSize;
-              err[loc[i]] = alpha_to[(err[loc[i]] - q + codewordSize) % codewordSize];
-              recd[loc[i]] ^= err[loc[i]]; /*recd[i] must be in polynomial form */
-            }
-          }
+          err = index_of[err];
+          q = 0; /* form denominator of error term */
+          for (j = 0; j < el; j++)
+            if (j != i)
+              q += index_of[1 ^ alpha_to[loc[j] + root[i]]];
+          q = GaloisField::modnn(q);
+          err = alpha_to[GaloisField::modnn(err - q + codewordSize)];
+          recd[loc[i]] ^= static_cast<Symbol>(err); /*recd[i] is in polynomial form */
         }
-        else /* no. roots != degree of elp => >tt errors and cannot solve */
-          // for (i = 0; i < codewordSize; i++) /* could return error flag if desired */
-          //   if (recd[i] != -1)               /* convert recd[] to polynomial form */
-          //     recd[i] = alpha_to[recd[i]];
-          //   else
-          //     recd[i] = 0;                 /* just output received codeword as is */
-          return AN_ERROR;
       }
-      else /* elp has degree has degree >tt hence cannot solve */
-        // for (i = 0; i < codewordSize; i++) /* could return error flag if desired */
-        //   if (recd[i] != -1)               /* convert recd[] to polynomial form */
-        //     recd[i] = alpha_to[recd[i]];
-        //   else
-        //     recd[i] = 0; /* just output received codeword as is */
-        return AN_ERROR;
     }
-    else /* no non-zero syndromes => no errors: output received codeword */
-      for (i = 0; i < codewordSize; i++)
-        if (recd[i] != -1) /* convert recd[] to polynomial form */
-          recd[i] = alpha_to[recd[i]];
-        else
-          recd[i] = 0;
+    else /* no. roots != degree of elp => >tt errors and cannot solve, recd[] is left as received */
+      return AN_ERROR;
 
     return NO_ERROR;
   }
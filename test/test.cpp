@@ -1,7 +1,10 @@
 #include <array>
+#include <memory>
 #include <optional>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
+#include <vector>
 
 #include "../ReedSolomon.hpp"
 
@@ -86,6 +89,607 @@ bool recoverAndValidateFaultyCodeword(
   return NO_ERROR;
 };
 
+// Deterministic pseudo-random source (xorshift) for the checks of larger codes
+uint32_t nextRandom()
+{
+  static uint32_t state{2463534242U};
+
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+template <typename RS>
+typename RS::Message randomMessage()
+{
+  typename RS::Message message{};
+
+  for (auto &element : message)
+  {
+    element = static_cast<typename RS::Symbol>(nextRandom() % (RS::codewordSize + 1U));
+  }
+
+  return message;
+}
+
+// Change the given amount of symbols at distinct positions spread over the codeword
+template <typename RS>
+void corruptCodeword(typename RS::Codeword &codeword, unsigned errors)
+{
+  const auto first{nextRandom() % RS::codewordSize};
+  const auto spacing{RS::codewordSize / ((errors != 0U) ? errors : 1U)};
+
+  for (auto error{0U}; error < errors; error++)
+  {
+    auto &element{codeword.at((first + error * spacing) % RS::codewordSize)};
+    element = static_cast<typename RS::Symbol>(element ^ (1U + nextRandom() % RS::codewordSize));
+  }
+}
+
+// A copy of the codeword with exactly t errors must be recovered, with t + 1 and 2t errors recovery must fail leaving
+// the copy as received
+template <typename RS>
+bool validateRecoveries(RS &rs, const typename RS::Codeword &expectedCodeword)
+{
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  constexpr unsigned amountOfCorrectableSymbols{RS::fecSize / 2U};
+
+  auto codeword{expectedCodeword};
+  corruptCodeword<RS>(codeword, amountOfCorrectableSymbols);
+  if (rs.recoverCodeword(codeword) || (codeword != expectedCodeword))
+  {
+    printf("\nError: It was not possible to recover codeword's data from %u errors", amountOfCorrectableSymbols);
+    return AN_ERROR;
+  }
+
+  for (const auto errors : {amountOfCorrectableSymbols + 1U, 2U * amountOfCorrectableSymbols})
+  {
+    auto faultyCodeword{expectedCodeword};
+    corruptCodeword<RS>(faultyCodeword, errors);
+    const auto receivedCodeword{faultyCodeword};
+    if (not rs.recoverCodeword(faultyCodeword) || (faultyCodeword != receivedCodeword))
+    {
+      printf("\nError: Recovery from %u errors should have failed leaving the codeword as received", errors);
+      return AN_ERROR;
+    }
+  }
+
+  return NO_ERROR;
+}
+
+// Recoveries of random codewords of larger codes, see validateRecoveries()
+template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+bool validateHeavyErrors(unsigned messages)
+{
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  using RS = reedsolomon::ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>;
+  RS rs{};
+
+  printf("\nRS(%d,%d) with %d and more errors: ", RS::codewordSize, RS::dataSize, AmountOfCorrectableSymbols);
+
+  for (auto index{0U}; index < messages; index++)
+  {
+    if (validateRecoveries(rs, rs.generateCodeword(randomMessage<RS>())))
+    {
+      return AN_ERROR;
+    }
+  }
+
+  printf("OK");
+  return NO_ERROR;
+}
+
+// Batches must give the codewords and recoveries of generateCodeword() and recoverCodeword(), message by message,
+// codeword k carrying k mod (t + 3) errors
+template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+bool validateBatch(std::size_t count)
+{
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  using RS = reedsolomon::ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>;
+  RS rs{};
+  std::vector<typename RS::Message> messages(count);
+  std::vector<typename RS::Codeword> codewords(count);
+  std::vector<typename RS::Codeword> expectedCodewords(count);
+  std::unique_ptr<bool[]> errors{new bool[count]};
+  std::size_t failures{0U};
+
+  printf("\nRS(%d,%d) batch of %zu: ", RS::codewordSize, RS::dataSize, count);
+
+  for (auto &message : messages)
+  {
+    message = randomMessage<RS>();
+  }
+
+  rs.generateCodewords(messages.data(), codewords.data(), count);
+  for (std::size_t index{0U}; index < count; index++)
+  {
+    expectedCodewords[index] = rs.generateCodeword(messages[index]);
+    if (codewords[index] != expectedCodewords[index])
+    {
+      printf("\nError: Codeword %zu of the batch do not match generateCodeword() one", index);
+      return AN_ERROR;
+    }
+    corruptCodeword<RS>(codewords[index], index % (AmountOfCorrectableSymbols + 3U));
+  }
+
+  std::vector<typename RS::Codeword> recovered{codewords};
+  rs.recoverCodewords(recovered.data(), errors.get(), count);
+  for (std::size_t index{0U}; index < count; index++)
+  {
+    const auto error{rs.recoverCodeword(codewords[index])};
+    if ((errors[index] != error) || (recovered[index] != codewords[index]))
+    {
+      printf("\nError: Recovery of codeword %zu of the batch do not match recoverCodeword() one", index);
+      return AN_ERROR;
+    }
+    if ((index % (AmountOfCorrectableSymbols + 3U) <= AmountOfCorrectableSymbols) && (error || (recovered[index] != expectedCodewords[index])))
+    {
+      printf("\nError: It was not possible to recover data of codeword %zu of the batch", index);
+      return AN_ERROR;
+    }
+    failures += error ? 1U : 0U;
+  }
+  if ((count > AmountOfCorrectableSymbols + 1U) && (failures == 0U))
+  {
+    printf("\nError: No codeword of the batch failed to recover from more than %d errors", AmountOfCorrectableSymbols);
+    return AN_ERROR;
+  }
+
+  printf("OK");
+  return NO_ERROR;
+}
+
+// FEC generated into a caller owned buffer must be the FEC of generateCodeword(), the codeword assembled from the
+// message and that FEC being recovered as usual
+template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+bool validateFec(unsigned messages)
+{
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  using RS = reedsolomon::ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>;
+  using Symbol = typename RS::Symbol;
+  RS rs{};
+
+  printf("\nRS(%d,%d) FEC into a caller owned buffer: ", RS::codewordSize, RS::dataSize);
+
+  for (auto index{0U}; index < messages; index++)
+  {
+    const auto message{randomMessage<RS>()};
+    const auto expectedCodeword{rs.generateCodeword(message)};
+
+    // FEC following a 2 symbols header of the caller's packet
+    Symbol packet[2U + RS::fecSize];
+    rs.generateFec(message.data(), packet + 2U);
+    if (memcmp(packet + 2U, expectedCodeword.data() + RS::dataSize, sizeof(Symbol) * RS::fecSize) != 0)
+    {
+      printf("\nError: Generated FEC do not match generateCodeword() one");
+      return AN_ERROR;
+    }
+
+    typename RS::Codeword codeword{};
+    memcpy(codeword.data(), message.data(), sizeof(Symbol) * RS::dataSize);
+    memcpy(codeword.data() + RS::dataSize, packet + 2U, sizeof(Symbol) * RS::fecSize);
+    if (validateRecoveries(rs, codeword))
+    {
+      return AN_ERROR;
+    }
+  }
+
+  printf("OK");
+  return NO_ERROR;
+}
+
+// Codewords generated and recovered in caller owned buffers must match the std::array ones, the codeword following a
+// 3 symbols header of the caller's packet
+template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+bool validateBuffers(unsigned messages)
+{
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  using RS = reedsolomon::ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>;
+  using Symbol = typename RS::Symbol;
+  static constexpr auto codewordBytes{sizeof(Symbol) * RS::codewordSize};
+  RS rs{};
+
+  printf("\nRS(%d,%d) codewords in caller owned buffers: ", RS::codewordSize, RS::dataSize);
+
+  for (auto index{0U}; index < messages; index++)
+  {
+    const auto message{randomMessage<RS>()};
+    const auto expectedCodeword{rs.generateCodeword(message)};
+    Symbol packet[3U + RS::codewordSize];
+
+    // message taken from its own buffer
+    rs.generateCodeword(message.data(), packet + 3U);
+    if (memcmp(packet + 3U, expectedCodeword.data(), codewordBytes) != 0)
+    {
+      printf("\nError: Codeword generated from a separate message do not match generateCodeword() one");
+      return AN_ERROR;
+    }
+
+    // message already in place, FEC appended
+    memset(packet, 0, sizeof(packet));
+    memcpy(packet + 3U, message.data(), sizeof(Symbol) * RS::dataSize);
+    rs.generateCodeword(packet + 3U, packet + 3U);
+    if (memcmp(packet + 3U, expectedCodeword.data(), codewordBytes) != 0)
+    {
+      printf("\nError: Codeword generated in place do not match generateCodeword() one");
+      return AN_ERROR;
+    }
+
+    // recovery from t errors
+    auto faultyCodeword{expectedCodeword};
+    corruptCodeword<RS>(faultyCodeword, AmountOfCorrectableSymbols);
+    memcpy(packet + 3U, faultyCodeword.data(), codewordBytes);
+    if (rs.recoverCodeword(packet + 3U) || (memcmp(packet + 3U, expectedCodeword.data(), codewordBytes) != 0))
+    {
+      printf("\nError: It was not possible to recover codeword's data from %d errors", AmountOfCorrectableSymbols);
+      return AN_ERROR;
+    }
+
+    // failure with t + 1 errors, leaving the buffer as received
+    faultyCodeword = expectedCodeword;
+    corruptCodeword<RS>(faultyCodeword, AmountOfCorrectableSymbols + 1U);
+    memcpy(packet + 3U, faultyCodeword.data(), codewordBytes);
+    if (not rs.recoverCodeword(packet + 3U) || (memcmp(packet + 3U, faultyCodeword.data(), codewordBytes) != 0))
+    {
+      printf("\nError: Recovery from %d errors should have failed leaving the codeword as received", AmountOfCorrectableSymbols + 1);
+      return AN_ERROR;
+    }
+  }
+
+  printf("OK");
+  return NO_ERROR;
+}
+
+// Streaming encoder fed by symbols or by chunks of varying sizes must give generateCodeword() FEC, message symbols not
+// taken counting as zeros, and refuse symbols past the message
+template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+bool validateEncoder(unsigned messages)
+{
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  using RS = reedsolomon::ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>;
+  using Symbol = typename RS::Symbol;
+  static constexpr auto fecBytes{sizeof(Symbol) * RS::fecSize};
+  RS rs{};
+  typename RS::Encoder encoder{};
+
+  printf("\nRS(%d,%d) streaming encoder: ", RS::codewordSize, RS::dataSize);
+
+  for (auto index{0U}; index < messages; index++)
+  {
+    const auto message{randomMessage<RS>()};
+    const auto expectedCodeword{rs.generateCodeword(message)};
+    typename RS::Codeword codeword{};
+
+    // symbol by symbol, then one symbol too many
+    for (auto position{0U}; position < RS::dataSize; position++)
+    {
+      if (encoder.push(message[position]))
+      {
+        printf("\nError: Encoder refused message symbol %u", position);
+        return AN_ERROR;
+      }
+    }
+    if (not encoder.push(message[0]))
+    {
+      printf("\nError: Encoder took a symbol past the message");
+      return AN_ERROR;
+    }
+    encoder.finish(codeword.data() + RS::dataSize);
+    if (memcmp(codeword.data() + RS::dataSize, expectedCodeword.data() + RS::dataSize, fecBytes) != 0)
+    {
+      printf("\nError: FEC streamed symbol by symbol do not match generateCodeword() one");
+      return AN_ERROR;
+    }
+
+    // chunks of 1 to 40 symbols, a chunk overflowing the message being refused as a whole
+    std::size_t position{0U};
+    for (std::size_t chunk{1U + index % 40U}; position < RS::dataSize; chunk = 1U + (chunk * 7U) % 40U)
+    {
+      if (position + chunk > RS::dataSize)
+      {
+        if (not encoder.push(message.data() + position, chunk))
+        {
+          printf("\nError: Encoder took a chunk past the message");
+          return AN_ERROR;
+        }
+        chunk = RS::dataSize - position;
+      }
+      if (encoder.push(message.data() + position, chunk))
+      {
+        printf("\nError: Encoder refused a chunk of the message");
+        return AN_ERROR;
+      }
+      position += chunk;
+    }
+    encoder.finish(codeword.data() + RS::dataSize);
+    if (memcmp(codeword.data() + RS::dataSize, expectedCodeword.data() + RS::dataSize, fecBytes) != 0)
+    {
+      printf("\nError: FEC streamed by chunks do not match generateCodeword() one");
+      return AN_ERROR;
+    }
+
+    memcpy(codeword.data(), message.data(), sizeof(Symbol) * RS::dataSize);
+    if (validateRecoveries(rs, codeword))
+    {
+      return AN_ERROR;
+    }
+
+    // message finished half way
+    auto truncatedMessage{message};
+    for (auto padding{RS::dataSize / 2U}; padding < RS::dataSize; padding++)
+    {
+      truncatedMessage[padding] = 0U;
+    }
+    encoder.push(message.data(), RS::dataSize / 2U);
+    encoder.finish(codeword.data() + RS::dataSize);
+    if (memcmp(codeword.data() + RS::dataSize, rs.generateCodeword(truncatedMessage).data() + RS::dataSize, fecBytes) != 0)
+    {
+      printf("\nError: FEC of a message finished half way do not match the one of the message padded with zeros");
+      return AN_ERROR;
+    }
+  }
+
+  printf("OK");
+  return NO_ERROR;
+}
+
+// FEC updated after changes of message symbols must be the FEC generated from the changed message, a position past the
+// message being refused without changing the FEC
+template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+bool validateFecUpdates(unsigned messages)
+{
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  using RS = reedsolomon::ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>;
+  using Symbol = typename RS::Symbol;
+  static constexpr auto fecBytes{sizeof(Symbol) * RS::fecSize};
+  static constexpr std::size_t changes{5U};
+  RS rs{};
+
+  printf("\nRS(%d,%d) FEC updates: ", RS::codewordSize, RS::dataSize);
+
+  for (auto index{0U}; index < messages; index++)
+  {
+    auto message{randomMessage<RS>()};
+    auto codeword{rs.generateCodeword(message)};
+    Symbol *fec{codeword.data() + RS::dataSize};
+
+    // change of one symbol
+    const uint16_t position{static_cast<uint16_t>(nextRandom() % RS::dataSize)};
+    const Symbol oldSymbol{message[position]};
+    message[position] = static_cast<Symbol>(oldSymbol ^ (1U + nextRandom() % RS::codewordSize));
+    if (rs.updateFec(fec, position, oldSymbol, message[position]) ||
+        (memcmp(fec, rs.generateCodeword(message).data() + RS::dataSize, fecBytes) != 0))
+    {
+      printf("\nError: FEC updated after a change of symbol %u do not match generated one", position);
+      return AN_ERROR;
+    }
+
+    // changes of several symbols at once, the last one at the end of the message
+    uint16_t positions[changes];
+    Symbol oldSymbols[changes];
+    Symbol newSymbols[changes];
+    for (std::size_t change{0U}; change < changes; change++)
+    {
+      positions[change] = static_cast<uint16_t>((change + 1U < changes) ? nextRandom() % RS::dataSize : RS::dataSize - 1U);
+      oldSymbols[change] = message[positions[change]];
+      newSymbols[change] = static_cast<Symbol>(nextRandom() % (RS::codewordSize + 1U));
+      message[positions[change]] = newSymbols[change];
+    }
+    if (rs.updateFec(fec, positions, oldSymbols, newSymbols, changes) ||
+        (memcmp(fec, rs.generateCodeword(message).data() + RS::dataSize, fecBytes) != 0))
+    {
+      printf("\nError: FEC updated after %zu changes do not match generated one", changes);
+      return AN_ERROR;
+    }
+
+    // position past the message
+    positions[changes - 1U] = RS::dataSize;
+    const auto expectedCodeword{rs.generateCodeword(message)};
+    if (not rs.updateFec(fec, positions, oldSymbols, newSymbols, changes) ||
+        (memcmp(fec, expectedCodeword.data() + RS::dataSize, fecBytes) != 0))
+    {
+      printf("\nError: FEC update past the message should have been refused leaving the FEC as it was");
+      return AN_ERROR;
+    }
+
+    memcpy(codeword.data(), message.data(), sizeof(Symbol) * RS::dataSize);
+    if (validateRecoveries(rs, codeword))
+    {
+      return AN_ERROR;
+    }
+  }
+
+  printf("OK");
+  return NO_ERROR;
+}
+
+// Bit-packed codewords and messages must unpack to the symbols they were packed from, the bits padding the last byte
+// cleared, and packed codewords be generated and recovered as their symbols are
+template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols>
+bool validatePacking(unsigned messages)
+{
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  using RS = reedsolomon::ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>;
+  static constexpr auto paddingMask{static_cast<uint8_t>(0xFFU >> ((RS::codewordSize * BitsPerSymbol) % 8U))};
+  RS rs{};
+
+  printf("\nRS(%d,%d) packed in %zu bytes: ", RS::codewordSize, RS::dataSize, RS::packedCodewordSize);
+
+  for (auto index{0U}; index < messages; index++)
+  {
+    const auto message{randomMessage<RS>()};
+    const auto expectedCodeword{rs.generateCodeword(message)};
+    uint8_t expectedPacked[RS::packedCodewordSize];
+    uint8_t packed[RS::packedCodewordSize];
+    typename RS::Codeword codeword{};
+    typename RS::Message unpackedMessage{};
+
+    memset(expectedPacked, 0xFF, sizeof(expectedPacked));
+    rs.packCodeword(expectedCodeword, expectedPacked);
+    rs.unpackCodeword(expectedPacked, codeword);
+    if ((codeword != expectedCodeword) || ((paddingMask != 0xFFU) && ((expectedPacked[RS::packedCodewordSize - 1U] & paddingMask) != 0U)))
+    {
+      printf("\nError: Codeword do not unpack to the symbols it was packed from or its padding bits are set");
+      return AN_ERROR;
+    }
+
+    rs.packMessage(message, packed);
+    rs.unpackMessage(packed, unpackedMessage);
+    if (unpackedMessage != message)
+    {
+      printf("\nError: Message do not unpack to the symbols it was packed from");
+      return AN_ERROR;
+    }
+
+    // packed message generated into its own buffer, then in place
+    uint8_t separate[RS::packedCodewordSize];
+    rs.generatePackedCodeword(packed, separate);
+    rs.generatePackedCodeword(packed, packed);
+    if ((memcmp(separate, expectedPacked, sizeof(separate)) != 0) || (memcmp(packed, expectedPacked, sizeof(packed)) != 0))
+    {
+      printf("\nError: Generated packed codeword do not match packed generateCodeword() one");
+      return AN_ERROR;
+    }
+
+    // recovery from t errors
+    auto faultyCodeword{expectedCodeword};
+    corruptCodeword<RS>(faultyCodeword, AmountOfCorrectableSymbols);
+    rs.packCodeword(faultyCodeword, packed);
+    if (rs.recoverPackedCodeword(packed) || (memcmp(packed, expectedPacked, sizeof(packed)) != 0))
+    {
+      printf("\nError: It was not possible to recover packed codeword's data from %d errors", AmountOfCorrectableSymbols);
+      return AN_ERROR;
+    }
+
+    // failure with t + 1 errors, leaving the bytes as received
+    faultyCodeword = expectedCodeword;
+    corruptCodeword<RS>(faultyCodeword, AmountOfCorrectableSymbols + 1U);
+    rs.packCodeword(faultyCodeword, packed);
+    memcpy(separate, packed, sizeof(packed));
+    if (not rs.recoverPackedCodeword(packed) || (memcmp(packed, separate, sizeof(packed)) != 0))
+    {
+      printf("\nError: Recovery of packed codeword from %d errors should have failed leaving it as received", AmountOfCorrectableSymbols + 1);
+      return AN_ERROR;
+    }
+  }
+
+  printf("OK");
+  return NO_ERROR;
+}
+
+// isValid() of a const codec must accept generated codewords and reject them with a single error in the message or in
+// the FEC part, or with more than t errors, whichever check the backend picks
+template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, reedsolomon::Arithmetic Backend>
+bool validateChecks(const char *name, unsigned messages)
+{
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  using RS = reedsolomon::ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols, Backend>;
+  RS encoder{};
+  const RS rs{};
+
+  printf("\nRS(%d,%d) %s backend codeword check: ", RS::codewordSize, RS::dataSize, name);
+
+  for (auto index{0U}; index < messages; index++)
+  {
+    const auto codeword{encoder.generateCodeword(randomMessage<RS>())};
+    if (not rs.isValid(codeword) || not rs.isValid(codeword.data()))
+    {
+      printf("\nError: Generated codeword not found valid");
+      return AN_ERROR;
+    }
+
+    for (const auto position : {index % RS::dataSize, RS::dataSize + index % RS::fecSize})
+    {
+      auto faultyCodeword{codeword};
+      faultyCodeword.at(position) = static_cast<typename RS::Symbol>(faultyCodeword.at(position) ^ (1U + nextRandom() % RS::codewordSize));
+      if (rs.isValid(faultyCodeword) || rs.isValid(faultyCodeword.data()))
+      {
+        printf("\nError: Codeword with an error at symbol %u found valid", position);
+        return AN_ERROR;
+      }
+    }
+
+    auto faultyCodeword{codeword};
+    corruptCodeword<RS>(faultyCodeword, AmountOfCorrectableSymbols + 1U);
+    if (rs.isValid(faultyCodeword))
+    {
+      printf("\nError: Codeword with %d errors found valid", AmountOfCorrectableSymbols + 1);
+      return AN_ERROR;
+    }
+  }
+
+  printf("OK");
+  return NO_ERROR;
+}
+
+// Codewords and recoveries of a backend, up to t + 2 errors, must match the LogAntilog ones
+template <uint8_t BitsPerSymbol, uint8_t AmountOfCorrectableSymbols, reedsolomon::Arithmetic Backend>
+bool validateBackend(const char *name, unsigned messages)
+{
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  using Reference = reedsolomon::ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols>;
+  reedsolomon::ReedSolomon<BitsPerSymbol, AmountOfCorrectableSymbols, Backend> rs{};
+  Reference reference{};
+
+  printf("\nRS(%d,%d) %s backend: ", Reference::codewordSize, Reference::dataSize, name);
+
+  for (auto index{0U}; index < messages; index++)
+  {
+    const auto message{randomMessage<Reference>()};
+    const auto expectedCodeword{reference.generateCodeword(message)};
+
+    if (rs.generateCodeword(message) != expectedCodeword)
+    {
+      printf("\nError: Generated codeword do not match LogAntilog one");
+      return AN_ERROR;
+    }
+
+    for (auto errors{0U}; errors <= AmountOfCorrectableSymbols + 2U; errors++)
+    {
+      auto expectedRecovered{expectedCodeword};
+      corruptCodeword<Reference>(expectedRecovered, errors);
+      auto recovered{expectedRecovered};
+
+      const auto expectedError{reference.recoverCodeword(expectedRecovered)};
+      const auto error{rs.recoverCodeword(recovered)};
+      if ((error != expectedError) || (recovered != expectedRecovered))
+      {
+        printf("\nError: Recovery from %u errors do not match LogAntilog one", errors);
+        return AN_ERROR;
+      }
+      if ((errors <= AmountOfCorrectableSymbols) && (error || (recovered != expectedCodeword)))
+      {
+        printf("\nError: It was not possible to recover codeword's data from %u errors", errors);
+        return AN_ERROR;
+      }
+    }
+  }
+
+  printf("OK");
+  return NO_ERROR;
+}
+
 int main()
 {
   // Test input
@@ -238,6 +842,164 @@ int main()
     printf("\nMessage recovering failed as expected");
   }
 
+  /* 8. Check every arithmetic backend against the LogAntilog one, from clean codewords to t + 2 errors */
+  {
+    using reedsolomon::Arithmetic;
+
+    printf("\n\nChecking arithmetic backends against LogAntilog");
+
+    const auto error{
+        validateBackend<4U, 3U, Arithmetic::MultiplicationTable>("MultiplicationTable", 50U) ||
+        validateBackend<4U, 3U, Arithmetic::Simd>("Simd", 50U) ||
+        validateBackend<8U, 16U, Arithmetic::MultiplicationTable>("MultiplicationTable", 20U) ||
+        validateBackend<8U, 16U, Arithmetic::Simd>("Simd", 20U) ||
+        validateBackend<10U, 8U, Arithmetic::CarryLess>("CarryLess", 10U) ||
+        validateBackend<16U, 4U, Arithmetic::CarryLess>("CarryLess", 2U) ||
+        validateBackend<16U, 4U, Arithmetic::Composite>("Composite", 2U)};
+    if (error)
+    {
+      return -1;
+    }
+  }
+
+  /* 9. Recover larger codes from exactly t errors and fail on more */
+  {
+    printf("\n\nChecking larger codes with heavy errors");
+
+    const auto error{
+        validateHeavyErrors<8U, 16U>(50U) ||
+        validateHeavyErrors<8U, 64U>(20U) ||
+        validateHeavyErrors<10U, 8U>(20U) ||
+        validateHeavyErrors<10U, 20U>(10U)};
+    if (error)
+    {
+      return -1;
+    }
+  }
+
+  /* 10. Encode and recover batches of small symbols, their syndromes checked bitsliced, batch sizes not being multiples
+        of the lanes */
+  {
+    printf("\n\nChecking batches of small symbols");
+
+    const auto error{
+        validateBatch<4U, 3U>(1U) ||
+        validateBatch<4U, 3U>(100U) ||
+        validateBatch<4U, 3U>(600U) ||
+        validateBatch<6U, 8U>(63U) ||
+        validateBatch<6U, 8U>(1000U)};
+    if (error)
+    {
+      return -1;
+    }
+  }
+
+  /* 11. Encode and recover batches of byte symbols, in structure of arrays lanes of 32 or 64 codewords */
+  {
+    printf("\n\nChecking batches of byte symbols");
+
+    const auto error{
+        validateBatch<8U, 16U>(1U) ||
+        validateBatch<8U, 16U>(33U) ||
+        validateBatch<8U, 16U>(65U) ||
+        validateBatch<8U, 16U>(100U) ||
+        validateBatch<5U, 2U>(97U)};
+    if (error)
+    {
+      return -1;
+    }
+  }
+
+  /* 12. Generate FEC into caller owned buffers */
+  {
+    printf("\n\nChecking FEC generation into caller owned buffers");
+
+    const auto error{
+        validateFec<8U, 16U>(20U) ||
+        validateFec<10U, 8U>(10U)};
+    if (error)
+    {
+      return -1;
+    }
+  }
+
+  /* 13. Generate and recover codewords in caller owned buffers, a byte per symbol for symbols of at most 8 bits */
+  {
+    printf("\n\nChecking codewords in caller owned buffers");
+
+    const auto error{
+        validateBuffers<6U, 8U>(20U) ||
+        validateBuffers<8U, 16U>(20U) ||
+        validateBuffers<10U, 8U>(10U)};
+    if (error)
+    {
+      return -1;
+    }
+  }
+
+  /* 14. Stream messages through the encoder */
+  {
+    printf("\n\nChecking streaming encoder");
+
+    const auto error{
+        validateEncoder<6U, 8U>(20U) ||
+        validateEncoder<8U, 16U>(20U) ||
+        validateEncoder<10U, 8U>(5U)};
+    if (error)
+    {
+      return -1;
+    }
+  }
+
+  /* 15. Update FEC after changes of message symbols */
+  {
+    printf("\n\nChecking FEC updates");
+
+    const auto error{
+        validateFecUpdates<6U, 8U>(20U) ||
+        validateFecUpdates<8U, 16U>(20U) ||
+        validateFecUpdates<10U, 8U>(10U)};
+    if (error)
+    {
+      return -1;
+    }
+  }
+
+  /* 16. Generate and recover bit-packed codewords */
+  {
+    printf("\n\nChecking bit-packed codewords");
+
+    const auto error{
+        validatePacking<5U, 4U>(20U) ||
+        validatePacking<6U, 8U>(20U) ||
+        validatePacking<8U, 16U>(20U) ||
+        validatePacking<10U, 8U>(10U) ||
+        validatePacking<12U, 4U>(5U)};
+    if (error)
+    {
+      return -1;
+    }
+  }
+
+  /* 17. Check codewords without decoding them, by re-encoding or by syndromes depending on the backend */
+  {
+    using reedsolomon::Arithmetic;
+
+    printf("\n\nChecking codewords without decoding");
+
+    const auto error{
+        validateChecks<4U, 3U, Arithmetic::LogAntilog>("LogAntilog", 50U) ||
+        validateChecks<8U, 16U, Arithmetic::MultiplicationTable>("MultiplicationTable", 20U) ||
+        validateChecks<8U, 16U, Arithmetic::Simd>("Simd", 20U) ||
+        validateChecks<10U, 8U, Arithmetic::LogAntilog>("LogAntilog", 10U) ||
+        validateChecks<10U, 8U, Arithmetic::CarryLess>("CarryLess", 10U) ||
+        validateChecks<16U, 4U, Arithmetic::Composite>("Composite", 2U)};
+    if (error)
+    {
+      return -1;
+    }
+  }
+
   printf("\n\nPASSED\n");
   return 0;
 }
\ No newline at end of file